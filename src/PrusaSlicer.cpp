@@ -584,6 +584,11 @@ int CLI::run(int argc, char **argv)
                 std::string outfile = m_config.opt_string("output");
                 Print       fff_print;
                 SLAPrint    sla_print;
+                // The Print is discarded after the export, its layers may be released while exporting.
+                if (const ConfigOptionBool *opt = m_config.opt<ConfigOptionBool>("release_exported_layers"); opt != nullptr)
+                    fff_print.set_release_layers_after_export(opt->value);
+                if (const ConfigOptionString *opt = m_config.opt<ConfigOptionString>("slices_cache"); opt != nullptr)
+                    fff_print.set_slices_cache_dir(opt->value);
                 sla_print.set_status_callback(
                             [](const PrintBase::SlicingStatus& s)
                 {
@@ -1063,7 +1063,9 @@ Clipper::Clipper(int initOptions) :
 void Clipper::Reset()
 {
   ClipperBase::Reset();
-  m_Scanbeam = std::priority_queue<cInt, cInts>{};
+  // Empty the scanbeam, but keep its capacity for a Clipper reused for many operations.
+  while (! m_Scanbeam.empty())
+    m_Scanbeam.pop();
   m_Maxima.clear();
   m_ActiveEdges = 0;
   m_SortedEdges = 0;
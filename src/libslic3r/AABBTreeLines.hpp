@@ -345,7 +345,7 @@ public:
         tree = AABBTreeLines::build_aabb_tree_over_indexed_lines(this->lines);
     }
 
-    explicit LinesDistancer(std::vector<LineType> &&lines) : lines(lines)
+    explicit LinesDistancer(std::vector<LineType> &&lines) : lines(std::move(lines))
     {
         tree = AABBTreeLines::build_aabb_tree_over_indexed_lines(this->lines);
     }
@@ -376,6 +376,31 @@ public:
         return {distance, nearest_line_index_out, nearest_point_out};
     }
 
+    // Same as above, the search is limited to the lines closer than the line hint_line_idx. Points sampled along a curve
+    // share their nearest line most of the time, thus passing the nearest line of the previous point of the curve
+    // prunes most of the AABB tree traversal. An invalid hint (size_t(-1)) falls back to the unbounded search.
+    // If more lines are at the same distance, the hint line is preferred.
+    template<bool SIGNED_DISTANCE>
+    std::tuple<Floating, size_t, Vec<2, Floating>> distance_from_lines_extra(const Vec<2, Scalar> &point, size_t hint_line_idx) const
+    {
+        if (hint_line_idx >= lines.size())
+            return distance_from_lines_extra<SIGNED_DISTANCE>(point);
+
+        Vec<2, typename LineType::Scalar> hint_point;
+        Floating         hint_sqr_distance      = Floating(line_alg::distance_to_squared(lines[hint_line_idx], point.template cast<typename LineType::Scalar>(), &hint_point));
+        size_t           nearest_line_index_out = hint_line_idx;
+        Vec<2, Floating> nearest_point_out      = hint_point.template cast<Floating>();
+        Vec<2, Floating> p                      = point.template cast<Floating>();
+        // Only a line closer than the hint line updates nearest_line_index_out and nearest_point_out.
+        Floating distance = sqrt(AABBTreeLines::squared_distance_to_indexed_lines(lines, tree, p, nearest_line_index_out, nearest_point_out, hint_sqr_distance));
+
+        if (SIGNED_DISTANCE) {
+            distance *= outside(point);
+        }
+
+        return {distance, nearest_line_index_out, nearest_point_out};
+    }
+
     template<bool SIGNED_DISTANCE> Floating distance_from_lines(const Vec<2, Scalar> &point) const
     {
         auto [dist, idx, np] = distance_from_lines_extra<SIGNED_DISTANCE>(point);
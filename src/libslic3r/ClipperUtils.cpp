@@ -14,6 +14,8 @@
 #include "ShortestPath.hpp"
 #include "Utils.hpp"
 
+#include <memory>
+
 // #define CLIPPER_UTILS_TIMING
 
 #ifdef CLIPPER_UTILS_TIMING
@@ -280,6 +282,26 @@ bool has_duplicate_points(const ClipperLib::PolyTree &polytree)
 }
 #endif
 
+void ClipperUtils::reset_engine(ClipperLib::Clipper &clipper)
+{
+    clipper.Clear();
+    clipper.ReverseSolution(false);
+    clipper.StrictlySimple(false);
+    clipper.PreserveCollinear(false);
+}
+
+void ClipperUtils::reset_engine(ClipperLib::ClipperOffset &co)
+{
+    co.Clear();
+    // Defaults of the ClipperOffset constructor.
+    co.MiterLimit         = 2.;
+    co.ArcTolerance       = 0.25;
+    co.ShortestEdgeLength = 0.;
+}
+
+using ClipperEngine       = ClipperUtils::ThreadLocalEngine<ClipperLib::Clipper>;
+using ClipperOffsetEngine = ClipperUtils::ThreadLocalEngine<ClipperLib::ClipperOffset>;
+
 // Offset CCW contours outside, CW contours (holes) inside.
 // Don't calculate union of the output paths.
 template<typename PathsProvider>
@@ -287,7 +309,8 @@ static ClipperLib::Paths raw_offset(PathsProvider &&paths, float offset, Clipper
 {
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
-    ClipperLib::ClipperOffset co;
+    ClipperOffsetEngine engine;
+    ClipperLib::ClipperOffset &co = *engine;
     ClipperLib::Paths out;
     out.reserve(paths.size());
     ClipperLib::Paths out_this;
@@ -330,7 +353,8 @@ TResult clipper_do(
 {
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
-    ClipperLib::Clipper clipper;
+    ClipperEngine engine;
+    ClipperLib::Clipper &clipper = *engine;
     clipper.AddPaths(std::forward<TSubj>(subject), ClipperLib::ptSubject, true);
     clipper.AddPaths(std::forward<TClip>(clip),    ClipperLib::ptClip,    true);
     TResult retval;
@@ -361,7 +385,8 @@ TResult clipper_union(
 {
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
-    ClipperLib::Clipper clipper;
+    ClipperEngine engine;
+    ClipperLib::Clipper &clipper = *engine;
     clipper.AddPaths(std::forward<TSubj>(subject), ClipperLib::ptSubject, true);
     TResult retval;
     clipper.Execute(ClipperLib::ctUnion, retval, fillType, fillType);
@@ -404,7 +429,8 @@ static TResult shrink_paths(PathsProvider &&paths, float offset, ClipperLib::Joi
     assert(offset > 0);
     TResult out;
     if (auto raw = raw_offset(std::forward<PathsProvider>(paths), - offset, joinType, miterLimit); ! raw.empty()) {
-        ClipperLib::Clipper clipper;
+        ClipperEngine engine;
+        ClipperLib::Clipper &clipper = *engine;
         clipper.AddPaths(raw, ClipperLib::ptSubject, true);
         ClipperLib::IntRect r = clipper.GetBounds();
         clipper.AddPath({ { r.left - 10, r.bottom + 10 }, { r.right + 10, r.bottom + 10 }, { r.right + 10, r.top - 10 }, { r.left - 10, r.top - 10 } }, ClipperLib::ptSubject, true);
@@ -452,7 +478,8 @@ static int offset_expolygon_inner(const Slic3r::ExPolygon &expoly, const float d
     // 1) Offset the outer contour.
     ClipperLib::Paths contours;
     {
-        ClipperLib::ClipperOffset co;
+        ClipperOffsetEngine engine;
+        ClipperLib::ClipperOffset &co = *engine;
         if (joinType == jtRound)
             co.ArcTolerance = miterLimit;
         else
@@ -472,13 +499,15 @@ static int offset_expolygon_inner(const Slic3r::ExPolygon &expoly, const float d
         // 2) Offset the holes one by one, collect the offsetted holes.
         ClipperLib::Paths holes;
         {
+            ClipperOffsetEngine engine;
+            ClipperLib::ClipperOffset &co = *engine;
+            if (joinType == jtRound)
+                co.ArcTolerance = miterLimit;
+            else
+                co.MiterLimit = miterLimit;
+            co.ShortestEdgeLength = std::abs(delta * ClipperOffsetShortestEdgeFactor);
             for (const Polygon &hole : expoly.holes) {
-                ClipperLib::ClipperOffset co;
-                if (joinType == jtRound)
-                    co.ArcTolerance = miterLimit;
-                else
-                    co.MiterLimit = miterLimit;
-                co.ShortestEdgeLength = std::abs(delta * ClipperOffsetShortestEdgeFactor);
+                co.Clear();
                 co.AddPath(hole.points, joinType, ClipperLib::etClosedPolygon);
                 ClipperLib::Paths out2;
                 // Execute reorients the contours so that the outer most contour has a positive area. Thus the output
@@ -809,7 +838,8 @@ Polylines _clipper_pl_open(ClipperLib::ClipType clipType, PathsProvider1 &&subje
 {
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
-    ClipperLib::Clipper clipper;
+    ClipperEngine engine;
+    ClipperLib::Clipper &clipper = *engine;
     clipper.AddPaths(std::forward<PathsProvider1>(subject), ClipperLib::ptSubject, false);
     clipper.AddPaths(std::forward<PathsProvider2>(clip), ClipperLib::ptClip, true);
     ClipperLib::PolyTree retval;
@@ -997,7 +1027,8 @@ Polygons simplify_polygons(const Polygons &subject)
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
     ClipperLib::Paths output;
-    ClipperLib::Clipper c;
+    ClipperEngine engine;
+    ClipperLib::Clipper &c = *engine;
 //    c.PreserveCollinear(true);
     //FIXME StrictlySimple is very expensive! Is it needed?
     c.StrictlySimple(true);
@@ -1013,7 +1044,8 @@ ExPolygons simplify_polygons_ex(const Polygons &subject, bool preserve_collinear
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
     ClipperLib::PolyTree polytree;
-    ClipperLib::Clipper c;
+    ClipperEngine engine;
+    ClipperLib::Clipper &c = *engine;
 //    c.PreserveCollinear(true);
     //FIXME StrictlySimple is very expensive! Is it needed?
     c.StrictlySimple(true);
@@ -1029,7 +1061,8 @@ Polygons top_level_islands(const Slic3r::Polygons &polygons)
     CLIPPER_UTILS_TIME_LIMIT_MILLIS(CLIPPER_UTILS_TIME_LIMIT_DEFAULT);
 
     // init Clipper
-    ClipperLib::Clipper clipper;
+    ClipperEngine engine;
+    ClipperLib::Clipper &clipper = *engine;
     clipper.Clear();
     // perform union
     clipper.AddPaths(ClipperUtils::PolygonsProvider(polygons), ClipperLib::ptSubject, true);
@@ -1055,7 +1088,8 @@ ClipperLib::Paths fix_after_outer_offset(
 
   	ClipperLib::Paths solution;
   	if (! input.empty()) {
-		ClipperLib::Clipper clipper;
+		ClipperEngine engine;
+		ClipperLib::Clipper &clipper = *engine;
 	  	clipper.AddPath(input, ClipperLib::ptSubject, true);
 		clipper.ReverseSolution(reverse_result);
 		clipper.Execute(ClipperLib::ctUnion, solution, filltype, filltype);
@@ -1075,7 +1109,8 @@ ClipperLib::Paths fix_after_inner_offset(
 
   	ClipperLib::Paths solution;
   	if (! input.empty()) {
-		ClipperLib::Clipper clipper;
+		ClipperEngine engine;
+		ClipperLib::Clipper &clipper = *engine;
 		clipper.AddPath(input, ClipperLib::ptSubject, true);
 		ClipperLib::IntRect r = clipper.GetBounds();
 		r.left -= 10; r.top -= 10; r.right += 10; r.bottom += 10;
@@ -1280,7 +1315,8 @@ Polygons variable_offset_inner(const ExPolygon &expoly, const std::vector<std::v
 	if (holes.empty())
 		output = std::move(contours);
 	else {
-		ClipperLib::Clipper clipper;
+		ClipperEngine engine;
+		ClipperLib::Clipper &clipper = *engine;
 		clipper.Clear();
 		clipper.AddPaths(contours, ClipperLib::ptSubject, true);
         // Holes may contain holes in holes produced by expanding a C hole shape.
@@ -1307,7 +1343,8 @@ ExPolygons variable_offset_inner_ex(const ExPolygon &expoly, const std::vector<s
         for (ClipperLib::Path &path : contours)
             output.emplace_back(std::move(path));
     } else {
-        ClipperLib::Clipper clipper;
+        ClipperEngine engine;
+        ClipperLib::Clipper &clipper = *engine;
         clipper.AddPaths(contours, ClipperLib::ptSubject, true);
         // Holes may contain holes in holes produced by expanding a C hole shape.
         // The situation is processed correctly by Clipper diff operation, producing concentric expolygons.
@@ -1370,7 +1407,8 @@ Polygons variable_offset_outer(const ExPolygon &expoly, const std::vector<std::v
         output = std::move(contours);
     else {
         //FIXME the difference is not needed as the holes may never intersect with other holes.
-        ClipperLib::Clipper clipper;
+        ClipperEngine engine;
+        ClipperLib::Clipper &clipper = *engine;
         clipper.Clear();
         clipper.AddPaths(contours, ClipperLib::ptSubject, true);
         clipper.AddPaths(holes, ClipperLib::ptClip, true);
@@ -1412,7 +1450,8 @@ ExPolygons variable_offset_outer_ex(const ExPolygon &expoly, const std::vector<s
         }
 	} else {
         //FIXME the difference is not needed as the holes may never intersect with other holes.
-		ClipperLib::Clipper clipper;
+		ClipperEngine engine;
+		ClipperLib::Clipper &clipper = *engine;
         // Contours may have holes if they were created by closing a C shape.
 		clipper.AddPaths(contours, ClipperLib::ptSubject, true);
 		clipper.AddPaths(holes, ClipperLib::ptClip, true);
@@ -335,6 +335,57 @@ namespace ClipperUtils {
     [[nodiscard]] Polygon   clip_clipper_polygon_with_subject_bbox(const Polygon &src, const BoundingBox &bbox);
     [[nodiscard]] Polygons  clip_clipper_polygons_with_subject_bbox(const Polygons &src, const BoundingBox &bbox);
     [[nodiscard]] Polygons  clip_clipper_polygons_with_subject_bbox(const ExPolygon &src, const BoundingBox &bbox);
+
+    // Clear the engine and restore its options to the defaults.
+    void reset_engine(ClipperLib::Clipper &clipper);
+    void reset_engine(ClipperLib::ClipperOffset &co);
+
+    // Clipper engine reused by the boolean and offset operations executed by a single thread.
+    // A cleared engine keeps the capacity of its local minima, scanbeam, joins, intersections and offset normals,
+    // thus a thread executing many small operations does not reallocate them. The edges and the output points
+    // are owned per input path / output polygon and they are released by Clear().
+    // If the engine of this thread is busy (ClipperUtils called recursively), a temporary engine is constructed.
+    template<typename Engine>
+    class ThreadLocalEngine
+    {
+    public:
+        ThreadLocalEngine() {
+            Slot &slot = ThreadLocalEngine::slot();
+            if (slot.busy) {
+                m_temp   = std::make_unique<Engine>();
+                m_engine = m_temp.get();
+            } else {
+                slot.busy = true;
+                m_slot    = &slot;
+                m_engine  = &slot.engine;
+            }
+        }
+        ~ThreadLocalEngine() {
+            if (m_slot) {
+                reset_engine(*m_engine);
+                m_slot->busy = false;
+            }
+        }
+        ThreadLocalEngine(const ThreadLocalEngine&) = delete;
+        ThreadLocalEngine& operator=(const ThreadLocalEngine&) = delete;
+
+        Engine& operator*()  { return *m_engine; }
+        Engine* operator->() { return m_engine; }
+
+        // Is this the engine retained by this thread, or a temporary one constructed because the former was busy?
+        bool    thread_local_engine() const { return m_slot != nullptr; }
+
+    private:
+        struct Slot {
+            Engine engine;
+            bool   busy { false };
+        };
+        static Slot& slot() { static thread_local Slot s; return s; }
+
+        Engine                  *m_engine { nullptr };
+        Slot                    *m_slot   { nullptr };
+        std::unique_ptr<Engine>  m_temp;
+    };
 }
 
 // offset Polygons
@@ -9,6 +9,9 @@
 
 #include <png.h>
 
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+
 #include "libslic3r.h"
 #include "ClipperUtils.hpp"
 #include "EdgeGrid.hpp"
@@ -692,89 +695,94 @@ void EdgeGrid::Grid::calculate_sdf()
 	float search_radius = float(m_resolution<<1);
 	m_signed_distance_field.assign(nrows * ncols, search_radius);
 	// For each cell:
-	for (int r = 0; r < (int)m_rows; ++ r) {
-		for (int c = 0; c < (int)m_cols; ++ c) {
-			const Cell &cell = m_cells[r * m_cols + c];
-			// For each segment in the cell:
-			for (size_t i = cell.begin; i != cell.end; ++ i) {
-				const Contour &contour = m_contours[m_cell_data[i].first];
-				assert(contour.closed());
-				size_t ipt = m_cell_data[i].second;
-				// End points of the line segment.
-				const Slic3r::Point &p1 = contour.segment_start(ipt);
-				const Slic3r::Point &p2 = contour.segment_end(ipt);
-				// Segment vector
-				const Slic3r::Point v_seg = p2 - p1;
-				// l2 of v_seg
-				const int64_t l2_seg = int64_t(v_seg(0)) * int64_t(v_seg(0)) + int64_t(v_seg(1)) * int64_t(v_seg(1));
-				// For each corner of this cell and its 1 ring neighbours:
-				for (int corner_y = -1; corner_y < 3; ++ corner_y) {
-					coord_t corner_r = r + corner_y;
-					if (corner_r < 0 || (size_t)corner_r >= nrows)
-						continue;
-					for (int corner_x = -1; corner_x < 3; ++ corner_x) {
-						coord_t corner_c = c + corner_x;
-						if (corner_c < 0 || (size_t)corner_c >= ncols)
-							continue;
-						float  &d_min = m_signed_distance_field[corner_r * ncols + corner_c];
-						Slic3r::Point pt(m_bbox.min(0) + corner_c * m_resolution, m_bbox.min(1) + corner_r * m_resolution);
-						Slic3r::Point v_pt = pt - p1;
-						// dot(p2-p1, pt-p1)
-						int64_t t_pt = int64_t(v_seg(0)) * int64_t(v_pt(0)) + int64_t(v_seg(1)) * int64_t(v_pt(1));
-						if (t_pt < 0) {
-							// Closest to p1.
-							double dabs = sqrt(int64_t(v_pt(0)) * int64_t(v_pt(0)) + int64_t(v_pt(1)) * int64_t(v_pt(1)));
-							if (dabs < d_min) {
-								// Previous point.
-								const Slic3r::Point &p0 = contour.segment_prev(ipt);
-								Slic3r::Point v_seg_prev = p1 - p0;
-								int64_t t2_pt = int64_t(v_seg_prev(0)) * int64_t(v_pt(0)) + int64_t(v_seg_prev(1)) * int64_t(v_pt(1));
-								if (t2_pt > 0) {
-									// Inside the wedge between the previous and the next segment.
-									// Set the signum depending on whether the vertex is convex or reflex.
-									int64_t det = int64_t(v_seg_prev(0)) * int64_t(v_seg(1)) - int64_t(v_seg_prev(1)) * int64_t(v_seg(0));
-									assert(det != 0);
-									d_min = dabs;
-									// Fill in an unsigned vector towards the zero iso surface.
-									float *l = &L[(corner_r * ncols + corner_c) << 1];
-									l[0] = std::abs(v_pt(0));
-									l[1] = std::abs(v_pt(1));
-								#ifdef _DEBUG
-									double dabs2 = sqrt(l[0]*l[0]+l[1]*l[1]);
-									assert(std::abs(dabs-dabs2) < 1e-4 * std::max(dabs, dabs2));
-								#endif /* _DEBUG */
-									signs[corner_r * ncols + corner_c] = ((det < 0) ? 1 : 0) | 2;
+	// Segments of a cell in row r only update the grid corners in rows <r - 1, r + 2>, thus the cells of rows 4 apart
+	// never touch the same corner. The rows are seeded in parallel in four interleaved passes.
+	for (int phase = 0; phase < 4; ++ phase)
+		tbb::parallel_for(tbb::blocked_range<int>(0, (int(m_rows) + 3 - phase) / 4), [&](const tbb::blocked_range<int> &range) {
+			for (int r = phase + 4 * range.begin(); r < phase + 4 * range.end(); r += 4) {
+				for (int c = 0; c < (int)m_cols; ++ c) {
+					const Cell &cell = m_cells[r * m_cols + c];
+					// For each segment in the cell:
+					for (size_t i = cell.begin; i != cell.end; ++ i) {
+						const Contour &contour = m_contours[m_cell_data[i].first];
+						assert(contour.closed());
+						size_t ipt = m_cell_data[i].second;
+						// End points of the line segment.
+						const Slic3r::Point &p1 = contour.segment_start(ipt);
+						const Slic3r::Point &p2 = contour.segment_end(ipt);
+						// Segment vector
+						const Slic3r::Point v_seg = p2 - p1;
+						// l2 of v_seg
+						const int64_t l2_seg = int64_t(v_seg(0)) * int64_t(v_seg(0)) + int64_t(v_seg(1)) * int64_t(v_seg(1));
+						// For each corner of this cell and its 1 ring neighbours:
+						for (int corner_y = -1; corner_y < 3; ++ corner_y) {
+							coord_t corner_r = r + corner_y;
+							if (corner_r < 0 || (size_t)corner_r >= nrows)
+								continue;
+							for (int corner_x = -1; corner_x < 3; ++ corner_x) {
+								coord_t corner_c = c + corner_x;
+								if (corner_c < 0 || (size_t)corner_c >= ncols)
+									continue;
+								float  &d_min = m_signed_distance_field[corner_r * ncols + corner_c];
+								Slic3r::Point pt(m_bbox.min(0) + corner_c * m_resolution, m_bbox.min(1) + corner_r * m_resolution);
+								Slic3r::Point v_pt = pt - p1;
+								// dot(p2-p1, pt-p1)
+								int64_t t_pt = int64_t(v_seg(0)) * int64_t(v_pt(0)) + int64_t(v_seg(1)) * int64_t(v_pt(1));
+								if (t_pt < 0) {
+									// Closest to p1.
+									double dabs = sqrt(int64_t(v_pt(0)) * int64_t(v_pt(0)) + int64_t(v_pt(1)) * int64_t(v_pt(1)));
+									if (dabs < d_min) {
+										// Previous point.
+										const Slic3r::Point &p0 = contour.segment_prev(ipt);
+										Slic3r::Point v_seg_prev = p1 - p0;
+										int64_t t2_pt = int64_t(v_seg_prev(0)) * int64_t(v_pt(0)) + int64_t(v_seg_prev(1)) * int64_t(v_pt(1));
+										if (t2_pt > 0) {
+											// Inside the wedge between the previous and the next segment.
+											// Set the signum depending on whether the vertex is convex or reflex.
+											int64_t det = int64_t(v_seg_prev(0)) * int64_t(v_seg(1)) - int64_t(v_seg_prev(1)) * int64_t(v_seg(0));
+											assert(det != 0);
+											d_min = dabs;
+											// Fill in an unsigned vector towards the zero iso surface.
+											float *l = &L[(corner_r * ncols + corner_c) << 1];
+											l[0] = std::abs(v_pt(0));
+											l[1] = std::abs(v_pt(1));
+										#ifdef _DEBUG
+											double dabs2 = sqrt(l[0]*l[0]+l[1]*l[1]);
+											assert(std::abs(dabs-dabs2) < 1e-4 * std::max(dabs, dabs2));
+										#endif /* _DEBUG */
+											signs[corner_r * ncols + corner_c] = ((det < 0) ? 1 : 0) | 2;
+										}
+									}
+								}
+								else if (t_pt > l2_seg) {
+									// Closest to p2. Then p2 is the starting point of another segment, which shall be discovered in the same cell.
+									continue;
+								} else {
+									// Closest to the segment.
+									assert(t_pt >= 0 && t_pt <= l2_seg);
+									int64_t d_seg = int64_t(v_seg(1)) * int64_t(v_pt(0)) - int64_t(v_seg(0)) * int64_t(v_pt(1));
+									double d = double(d_seg) / sqrt(double(l2_seg));
+									double dabs = std::abs(d);
+									if (dabs < d_min) {
+										d_min = dabs;
+										// Fill in an unsigned vector towards the zero iso surface.
+										float *l = &L[(corner_r * ncols + corner_c) << 1];
+										float linv = float(d_seg) / float(l2_seg);
+										l[0] = std::abs(float(v_seg(1)) * linv);
+										l[1] = std::abs(float(v_seg(0)) * linv);
+										#ifdef _DEBUG
+											double dabs2 = sqrt(l[0]*l[0]+l[1]*l[1]);
+											assert(std::abs(dabs-dabs2) <= 1e-4 * std::max(dabs, dabs2));
+										#endif /* _DEBUG */
+										signs[corner_r * ncols + corner_c] = ((d_seg < 0) ? 1 : 0) | 2;
+									}
 								}
-							}
-						}
-						else if (t_pt > l2_seg) {
-							// Closest to p2. Then p2 is the starting point of another segment, which shall be discovered in the same cell.
-							continue;
-						} else {
-							// Closest to the segment.
-							assert(t_pt >= 0 && t_pt <= l2_seg);
-							int64_t d_seg = int64_t(v_seg(1)) * int64_t(v_pt(0)) - int64_t(v_seg(0)) * int64_t(v_pt(1));
-							double d = double(d_seg) / sqrt(double(l2_seg));
-							double dabs = std::abs(d);
-							if (dabs < d_min) {
-								d_min = dabs;
-								// Fill in an unsigned vector towards the zero iso surface.
-								float *l = &L[(corner_r * ncols + corner_c) << 1];
-								float linv = float(d_seg) / float(l2_seg);
-								l[0] = std::abs(float(v_seg(1)) * linv);
-								l[1] = std::abs(float(v_seg(0)) * linv);
-								#ifdef _DEBUG
-									double dabs2 = sqrt(l[0]*l[0]+l[1]*l[1]);
-									assert(std::abs(dabs-dabs2) <= 1e-4 * std::max(dabs, dabs2));
-								#endif /* _DEBUG */
-								signs[corner_r * ncols + corner_c] = ((d_seg < 0) ? 1 : 0) | 2;
 							}
 						}
 					}
 				}
 			}
-		}
-	}
+		});
 
 #ifdef EDGE_GRID_DEBUG_OUTPUT
 	{ 
@@ -891,16 +899,18 @@ void EdgeGrid::Grid::calculate_sdf()
 	}
 
 	// Update signed distance field from absolte vectors to the iso-surface.
-	for (size_t r = 0; r < nrows; ++ r) {
-		for (size_t c = 0; c < ncols; ++ c) {
-			size_t  addr = r * ncols + c;
-			float  *v    = &L[addr<<1];
-			float   d    = sqrt(v[0]*v[0]+v[1]*v[1]);
-			if (signs[addr] & 1)
-				d = -d;
-			m_signed_distance_field[addr] = d;
+	tbb::parallel_for(tbb::blocked_range<size_t>(0, nrows), [this, ncols, &L, &signs](const tbb::blocked_range<size_t> &range) {
+		for (size_t r = range.begin(); r < range.end(); ++ r) {
+			for (size_t c = 0; c < ncols; ++ c) {
+				size_t  addr = r * ncols + c;
+				float  *v    = &L[addr<<1];
+				float   d    = sqrt(v[0]*v[0]+v[1]*v[1]);
+				if (signs[addr] & 1)
+					d = -d;
+				m_signed_distance_field[addr] = d;
+			}
 		}
-	}
+	});
 
 #ifdef EDGE_GRID_DEBUG_OUTPUT
 	{
@@ -1282,6 +1292,34 @@ bool EdgeGrid::Grid::signed_distance(const Point &pt, coord_t search_radius, coo
 	return true;
 }
 
+std::vector<size_t> EdgeGrid::Grid::sort_queries_by_cell(const Points &pts) const
+{
+	std::vector<std::pair<size_t, size_t>> cell_and_idx;
+	cell_and_idx.reserve(pts.size());
+	for (const Point &pt : pts) {
+		coord_t c = std::clamp<coord_t>((pt.x() - m_bbox.min.x()) / m_resolution, 0, coord_t(m_cols) - 1);
+		coord_t r = std::clamp<coord_t>((pt.y() - m_bbox.min.y()) / m_resolution, 0, coord_t(m_rows) - 1);
+		cell_and_idx.emplace_back(size_t(r) * m_cols + size_t(c), &pt - pts.data());
+	}
+	std::sort(cell_and_idx.begin(), cell_and_idx.end());
+	std::vector<size_t> out;
+	out.reserve(pts.size());
+	for (const std::pair<size_t, size_t> &ci : cell_and_idx)
+		out.emplace_back(ci.second);
+	return out;
+}
+
+void EdgeGrid::Grid::closest_point_signed_distance(const Points &pts, coord_t search_radius, std::vector<ClosestPointResult> &out) const
+{
+	out.assign(pts.size(), ClosestPointResult());
+	std::vector<size_t> order = this->sort_queries_by_cell(pts);
+	// Closest point queries visit a neighborhood of cells each, thus they are split into smaller chunks.
+	tbb::parallel_for(tbb::blocked_range<size_t>(0, order.size(), 256), [this, &pts, &order, search_radius, &out](const tbb::blocked_range<size_t> &range) {
+		for (size_t i = range.begin(); i < range.end(); ++ i)
+			out[order[i]] = this->closest_point_signed_distance(pts[order[i]], search_radius);
+	});
+}
+
 Polygons EdgeGrid::Grid::contours_simplified(coord_t offset, bool fill_holes) const
 {
 	assert(std::abs(2 * offset) < m_resolution);
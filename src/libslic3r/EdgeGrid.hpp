@@ -160,6 +160,11 @@ public:
 	// Only call this function for closed contours!
 	bool signed_distance(const Point &pt, coord_t search_radius, coordf_t &result_min_dist) const;
 
+	// Batched variant of closest_point_signed_distance(), out[i] is the result for pts[i].
+	// The queries are evaluated in the order of the grid cells they fall into, so that the cells and contour segments
+	// shared by neighboring queries are visited while still in cache, and the batch is split among worker threads.
+	void closest_point_signed_distance(const Points &pts, coord_t search_radius, std::vector<ClosestPointResult> &out) const;
+
 	const BoundingBox& 	bbox() const { return m_bbox; }
 	const coord_t 		resolution() const { return m_resolution; }
 	const size_t		rows() const { return m_rows; }
@@ -367,6 +372,8 @@ protected:
 	};
 
 	void create_from_m_contours(coord_t resolution);
+	// Indices of pts sorted by the grid cell they fall into, points outside of the grid are clamped to the border cells.
+	std::vector<size_t> sort_queries_by_cell(const Points &pts) const;
 #if 0
 	bool line_cell_intersect(const Point &p1, const Point &p2, const Cell &cell);
 #endif
@@ -15,10 +15,13 @@
 #include "Polyline.hpp"
 
 #include <assert.h>
+#include <new>
 #include <optional>
 #include <string_view>
 #include <numeric>
 
+#include <oneapi/tbb/scalable_allocator.h>
+
 namespace Slic3r {
 
 class ExPolygon;
@@ -62,6 +65,16 @@ public:
     virtual Polylines as_polylines() const { Polylines dst; this->collect_polylines(dst); return dst; }
     virtual double length() const = 0;
     virtual double total_volume() const = 0;
+
+    // Extrusion entities are allocated one by one and in large numbers by the perimeter, infill and support generators
+    // running in parallel. Allocate them from the thread local pools of the TBB scalable allocator, as the Points are,
+    // to avoid contention on the global heap and to keep the entities of a layer close to each other in memory.
+    static void* operator new(size_t size) {
+        if (void *ptr = scalable_malloc(size); ptr)
+            return ptr;
+        throw std::bad_alloc();
+    }
+    static void operator delete(void *ptr) { scalable_free(ptr); }
 };
 
 using ExtrusionEntitiesPtr = std::vector<ExtrusionEntity*>;
@@ -142,6 +142,15 @@ ExtrusionEntityCollection ExtrusionEntityCollection::flatten(bool preserve_order
     return flatten.out;
 }
 
+void ExtrusionEntityCollection::collect_leaves(std::vector<const ExtrusionEntity*> &out) const
+{
+    for (const ExtrusionEntity *entity : this->entities)
+        if (entity->is_collection())
+            static_cast<const ExtrusionEntityCollection*>(entity)->collect_leaves(out);
+        else
+            out.emplace_back(entity);
+}
+
 double ExtrusionEntityCollection::min_mm3_per_mm() const
 {
     double min_mm3_per_mm = std::numeric_limits<double>::max();
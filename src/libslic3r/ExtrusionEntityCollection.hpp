@@ -127,6 +127,9 @@ public:
     /// You should be iterating over flatten().entities if you are interested in the underlying ExtrusionEntities (and don't care about hierarchy).
     /// \param preserve_ordering Flag to method that will flatten if and only if the underlying collection is sortable when True (default: False).
     ExtrusionEntityCollection flatten(bool preserve_ordering = false) const;
+    /// Collects pointers to the items, which flatten() with preserve_ordering == false would copy.
+    /// Cheaper than flatten() if the items are only to be inspected, as nothing is copied.
+    void collect_leaves(std::vector<const ExtrusionEntity*> &out) const;
     double min_mm3_per_mm() const override;
     double total_volume() const override { double volume=0.; for (const auto& ent : entities) volume+=ent->total_volume(); return volume; }
 
@@ -23,10 +23,13 @@
 #include "FillBase.hpp"
 #include "FillRectilinear.hpp"
 #include "FillLightning.hpp"
+#include "FillPlanePath.hpp"
 #include "FillConcentric.hpp"
 #include "FillEnsuring.hpp"
 #include "Polygon.hpp"
 
+#include <tbb/parallel_for.h>
+
 namespace Slic3r {
 
 //static constexpr const float NarrowInfillAreaThresholdMM = 3.f;
@@ -447,7 +450,7 @@ void Layer::clear_fills()
 			island.fills.clear();
 }
 
-void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive::Octree* support_fill_octree, FillLightning::Generator* lightning_generator)
+void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive::Octree* support_fill_octree, FillLightning::Generator* lightning_generator, PlanePathCurves* plane_path_curves)
 {
 	this->clear_fills();
 
@@ -468,6 +471,11 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
 #endif /* SLIC3R_DEBUG_SLICE_PROCESSING */
 
 	size_t first_object_layer_id = this->object()->get_layer(0)->id();
+    // One configured filler and fill parameters per SurfaceFill.
+    std::vector<std::unique_ptr<Fill>> fillers;
+    std::vector<FillParams>            fill_params;
+    fillers.reserve(surface_fills.size());
+    fill_params.reserve(surface_fills.size());
     for (SurfaceFill &surface_fill : surface_fills) {
 	//if(surface_fill.params.bridge)
 		//surface_fill.params.pattern = this->regions().front()->region().config().bridge_fill_pattern.value;
@@ -488,6 +496,9 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
         if (surface_fill.params.pattern == ipLightning)
             dynamic_cast<FillLightning::Filler*>(f.get())->generator = lightning_generator;
 
+        if (auto *fill_plane_path = dynamic_cast<FillPlanePath*>(f.get()); fill_plane_path != nullptr)
+            fill_plane_path->curves = plane_path_curves;
+
         if (surface_fill.params.pattern == ipEnsuring) {
             auto *fill_ensuring = dynamic_cast<FillEnsuring *>(f.get());
             assert(fill_ensuring != nullptr);
@@ -495,7 +506,6 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
         }
 
         // calculate flow spacing for infill pattern generation
-        bool using_internal_flow = ! surface_fill.surface.is_solid() && ! surface_fill.params.bridge;
         double link_max_length = 0.;
         if (! surface_fill.params.bridge) {
 #if 0
@@ -525,68 +535,102 @@ void Layer::make_fills(FillAdaptive::Octree* adaptive_fill_octree, FillAdaptive:
         params.layer_height      = layerm.layer()->height;
 	params.config = &layerm.region().config();
 
-        for (ExPolygon &expoly : surface_fill.expolygons) {
-			// Spacing is modified by the filler to indicate adjustments. Reset it for each expolygon.
-			f->spacing = surface_fill.params.spacing;
-			surface_fill.surface.expolygon = std::move(expoly);
-            Polylines      polylines;
-            ThickPolylines thick_polylines;
-			try {
+        fillers.emplace_back(std::move(f));
+        fill_params.emplace_back(params);
+    }
+
+    // Each ExPolygon of each SurfaceFill is filled independently, possibly in parallel with the other ExPolygons
+    // of this layer: Layers with a few large surfaces would not keep all the cores busy if parallelized over layers only.
+    // The results are collected by index and stored into the layer regions in the original order below,
+    // thus the G-code does not depend on thread scheduling.
+    struct FillJob {
+        size_t          surface_fill_id;
+        ExPolygon      *expolygon;
+        Polylines       polylines;
+        ThickPolylines  thick_polylines;
+        // Spacing as adjusted by the filler.
+        coordf_t        spacing;
+    };
+    std::vector<FillJob> fill_jobs;
+    for (size_t surface_fill_id = 0; surface_fill_id < surface_fills.size(); ++ surface_fill_id)
+        for (ExPolygon &expoly : surface_fills[surface_fill_id].expolygons)
+            fill_jobs.push_back({ surface_fill_id, &expoly });
+
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, fill_jobs.size(), 1), [&surface_fills, &fillers, &fill_params, &fill_jobs](const tbb::blocked_range<size_t> &range) {
+        for (size_t job_id = range.begin(); job_id < range.end(); ++ job_id) {
+            FillJob           &job          = fill_jobs[job_id];
+            const SurfaceFill &surface_fill = surface_fills[job.surface_fill_id];
+            const FillParams  &params       = fill_params[job.surface_fill_id];
+            // Fillers are not reentrant, and the spacing is modified by the filler to indicate adjustments.
+            std::unique_ptr<Fill> f(fillers[job.surface_fill_id]->clone());
+            f->spacing = surface_fill.params.spacing;
+            Surface surface(surface_fill.surface, std::move(*job.expolygon));
+            try {
                 if (params.use_arachne)
-                    thick_polylines = f->fill_surface_arachne(&surface_fill.surface, params);
+                    job.thick_polylines = f->fill_surface_arachne(&surface, params);
                 else
-				    polylines = f->fill_surface(&surface_fill.surface, params);
-			} catch (InfillFailedException &) {
-			}
-            if (!polylines.empty() || !thick_polylines.empty()) {
-                // calculate actual flow from spacing (which might have been adjusted by the infill
-		        // pattern generator)
-		        double flow_mm3_per_mm = surface_fill.params.flow.mm3_per_mm();
-		        double flow_width      = surface_fill.params.flow.width();
-		        if (using_internal_flow) {
-		            // if we used the internal flow we're not doing a solid infill
-		            // so we can safely ignore the slight variation that might have
-		            // been applied to f->spacing
-		        } else {
-		            Flow new_flow   = surface_fill.params.flow.with_spacing(float(f->spacing));
-		        	flow_mm3_per_mm = new_flow.mm3_per_mm();
-		        	flow_width      = new_flow.width();
-		        }
-                auto fill_begin = uint32_t(layerm.fills().size());
-                // Save into layer.
-                if (ExtrusionEntityCollection *eec = nullptr; params.use_arachne) {
-                    for (const ThickPolyline &thick_polyline : thick_polylines) {
-                        Flow new_flow = surface_fill.params.flow.with_spacing(float(f->spacing));
-
-                        ExtrusionMultiPath multi_path = PerimeterGenerator::thick_polyline_to_multi_path(thick_polyline, surface_fill.params.extrusion_role, new_flow, scaled<float>(0.05), float(SCALED_EPSILON));
-                        // Append paths to collection.
-                        if (!multi_path.empty()) {
-                            layerm.m_fills.entities.push_back(eec = new ExtrusionEntityCollection());
-                            // Only concentric fills are not sorted.
-                            eec->no_sort = f->no_sort();
-
-                            if (multi_path.paths.front().first_point() == multi_path.paths.back().last_point())
-                                eec->entities.emplace_back(new ExtrusionLoop(std::move(multi_path.paths)));
-                            else
-                                eec->entities.emplace_back(new ExtrusionMultiPath(std::move(multi_path)));
-                        }
-                    }
+                    job.polylines = f->fill_surface(&surface, params);
+            } catch (InfillFailedException &) {
+            }
+            job.spacing = f->spacing;
+        }
+    });
 
-                    thick_polylines.clear();
-                } else {
-                    layerm.m_fills.entities.push_back(eec = new ExtrusionEntityCollection());
-                    // Only concentric fills are not sorted.
-                    eec->no_sort = f->no_sort();
-
-                    extrusion_entities_append_paths(
-                        eec->entities, std::move(polylines),
-						ExtrusionAttributes{ surface_fill.params.extrusion_role,
-							ExtrusionFlow{ flow_mm3_per_mm, float(flow_width), surface_fill.params.flow.height() } 
-						});
+    for (FillJob &job : fill_jobs) {
+        const SurfaceFill &surface_fill = surface_fills[job.surface_fill_id];
+        const Fill        &f            = *fillers[job.surface_fill_id];
+        LayerRegion       &layerm       = *m_regions[surface_fill.region_id];
+        bool using_internal_flow = ! surface_fill.surface.is_solid() && ! surface_fill.params.bridge;
+        Polylines      &polylines       = job.polylines;
+        ThickPolylines &thick_polylines = job.thick_polylines;
+        if (!polylines.empty() || !thick_polylines.empty()) {
+            // calculate actual flow from spacing (which might have been adjusted by the infill
+	        // pattern generator)
+	        double flow_mm3_per_mm = surface_fill.params.flow.mm3_per_mm();
+	        double flow_width      = surface_fill.params.flow.width();
+	        if (using_internal_flow) {
+	            // if we used the internal flow we're not doing a solid infill
+	            // so we can safely ignore the slight variation that might have
+	            // been applied to f->spacing
+	        } else {
+	            Flow new_flow   = surface_fill.params.flow.with_spacing(float(job.spacing));
+	        	flow_mm3_per_mm = new_flow.mm3_per_mm();
+	        	flow_width      = new_flow.width();
+	        }
+            auto fill_begin = uint32_t(layerm.fills().size());
+            // Save into layer.
+            if (ExtrusionEntityCollection *eec = nullptr; fill_params[job.surface_fill_id].use_arachne) {
+                for (const ThickPolyline &thick_polyline : thick_polylines) {
+                    Flow new_flow = surface_fill.params.flow.with_spacing(float(job.spacing));
+
+                    ExtrusionMultiPath multi_path = PerimeterGenerator::thick_polyline_to_multi_path(thick_polyline, surface_fill.params.extrusion_role, new_flow, scaled<float>(0.05), float(SCALED_EPSILON));
+                    // Append paths to collection.
+                    if (!multi_path.empty()) {
+                        layerm.m_fills.entities.push_back(eec = new ExtrusionEntityCollection());
+                        // Only concentric fills are not sorted.
+                        eec->no_sort = f.no_sort();
+
+                        if (multi_path.paths.front().first_point() == multi_path.paths.back().last_point())
+                            eec->entities.emplace_back(new ExtrusionLoop(std::move(multi_path.paths)));
+                        else
+                            eec->entities.emplace_back(new ExtrusionMultiPath(std::move(multi_path)));
+                    }
                 }
-                insert_fills_into_islands(*this, uint32_t(surface_fill.region_id), fill_begin, uint32_t(layerm.fills().size()));
-		    }
-		}
+
+                thick_polylines.clear();
+            } else {
+                layerm.m_fills.entities.push_back(eec = new ExtrusionEntityCollection());
+                // Only concentric fills are not sorted.
+                eec->no_sort = f.no_sort();
+
+                extrusion_entities_append_paths(
+                    eec->entities, std::move(polylines),
+					ExtrusionAttributes{ surface_fill.params.extrusion_role,
+						ExtrusionFlow{ flow_mm3_per_mm, float(flow_width), surface_fill.params.flow.height() } 
+					});
+            }
+            insert_fills_into_islands(*this, uint32_t(surface_fill.region_id), fill_begin, uint32_t(layerm.fills().size()));
+	    }
     }
 
 	for (LayerSlice &lslice : this->lslices_ex)
@@ -19,7 +19,9 @@ class InfillPolylineClipper : public FillPlanePath::InfillPolylineOutput {
 public:
     InfillPolylineClipper(const BoundingBox bbox, const double scale_out) : FillPlanePath::InfillPolylineOutput(scale_out), m_bbox(bbox) {}
 
-    void            add_point(const Vec2d &pt);
+    void            add_point(const Vec2d &pt) { this->add_scaled_point(this->scaled(pt)); }
+    // Add a point already scaled by scale_out, for example a point of a cached curve.
+    void            add_scaled_point(const Point &pt);
     Points&&        result() { return std::move(m_out); }
     bool            clips() const override { return true; }
 
@@ -46,10 +48,8 @@ private:
     int         m_sides_this;
 };
 
-void InfillPolylineClipper::add_point(const Vec2d &fpt)
+void InfillPolylineClipper::add_scaled_point(const Point &pt)
 {
-    const Point pt{ this->scaled(fpt) };
-
     if (m_out.size() < 2) {
         // Collect the two first points and their status.
         (m_out.empty() ? m_sides_prev : m_sides_this) = sides(pt);
@@ -75,6 +75,28 @@ void InfillPolylineClipper::add_point(const Vec2d &fpt)
     }
 }
 
+std::shared_ptr<const Points> PlanePathCurves::find(const Key &key) const
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    for (const auto &curve : m_curves)
+        if (curve.first == key)
+            return curve.second;
+    return nullptr;
+}
+
+std::shared_ptr<const Points> PlanePathCurves::store(const Key &key, Points &&curve)
+{
+    std::scoped_lock<std::mutex> lock(m_mutex);
+    for (const auto &cached : m_curves)
+        if (cached.first == key)
+            // Another thread generated the same curve.
+            return cached.second;
+    auto out = std::make_shared<const Points>(std::move(curve));
+    if (m_curves.size() < max_curves)
+        m_curves.emplace_back(key, out);
+    return out;
+}
+
 void FillPlanePath::_fill_surface_single(
     const FillParams                &params, 
     unsigned int                     thickness_layers,
@@ -117,7 +139,19 @@ void FillPlanePath::_fill_surface_single(
             // Filling in a bounding box over the whole object, clip generated polyline against the snug bounding box.
             snug_bounding_box.translate(-shift.x(), -shift.y());
             InfillPolylineClipper output(snug_bounding_box, distance_between_lines);
-            this->generate(min_x, min_y, max_x, max_y, resolution, output);
+            if (this->curves) {
+                // The curve over the object's bounding box is the same for all layers, generate it once.
+                const PlanePathCurves::Key key { typeid(*this), min_x, min_y, max_x, max_y, resolution, distance_between_lines };
+                std::shared_ptr<const Points> curve = this->curves->find(key);
+                if (! curve) {
+                    InfillPolylineOutput unclipped(distance_between_lines);
+                    this->generate(min_x, min_y, max_x, max_y, resolution, unclipped);
+                    curve = this->curves->store(key, std::move(unclipped.result()));
+                }
+                for (const Point &pt : *curve)
+                    output.add_scaled_point(pt);
+            } else
+                this->generate(min_x, min_y, max_x, max_y, resolution, output);
             polyline.points = std::move(output.result());
         } else {
             // Filling in a snug bounding box, no need to clip.
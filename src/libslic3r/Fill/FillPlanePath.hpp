@@ -11,6 +11,9 @@
 #define slic3r_FillPlanePath_hpp_
 
 #include <map>
+#include <memory>
+#include <mutex>
+#include <typeindex>
 
 #include "../libslic3r.h"
 
@@ -22,11 +25,48 @@ namespace Slic3r {
 // http://user42.tuxfamily.org/math-planepath/
 // http://user42.tuxfamily.org/math-planepath/gallery.html
 
+// Plane path curves of the sparse infill, generated over the whole object's bounding box before being clipped
+// by the surfaces. Such a curve does not depend on the layer, thus the curve is generated once and shared by all the layers
+// of a single PrintObject. Only a few curves are retained (one per infill spacing and angle), further curves are generated
+// and not cached.
+class PlanePathCurves
+{
+public:
+    struct Key {
+        std::type_index type;
+        coord_t         min_x;
+        coord_t         min_y;
+        coord_t         max_x;
+        coord_t         max_y;
+        double          resolution;
+        double          scale_out;
+
+        bool operator==(const Key &rhs) const {
+            return type == rhs.type && min_x == rhs.min_x && min_y == rhs.min_y && max_x == rhs.max_x && max_y == rhs.max_y &&
+                   resolution == rhs.resolution && scale_out == rhs.scale_out;
+        }
+    };
+
+    // Returns nullptr if the curve was not generated yet.
+    std::shared_ptr<const Points> find(const Key &key) const;
+    // Returns the curve cached under the key, which may have been stored by another thread in the meantime.
+    std::shared_ptr<const Points> store(const Key &key, Points &&curve);
+
+private:
+    static constexpr size_t max_curves = 4;
+
+    mutable std::mutex                                          m_mutex;
+    std::vector<std::pair<Key, std::shared_ptr<const Points>>>  m_curves;
+};
+
 class FillPlanePath : public Fill
 {
 public:
     ~FillPlanePath() override = default;
 
+    // Curves shared by the layers of a single PrintObject, may be null.
+    PlanePathCurves *curves { nullptr };
+
 protected:
     void _fill_surface_single(
         const FillParams                &params, 
@@ -771,6 +771,45 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
         segs[i].idx = i;
         segs[i].pos = x0 + i * line_spacing;
     }
+    // Range of the equally spaced vertical lines intersected by a segment, empty if il > ir.
+    auto vertical_lines_range = [x0, line_spacing, n_vlines](const Point &p1, const Point &p2, int &il, int &ir) {
+        coord_t l = p1.x();
+        coord_t r = p2.x();
+        if (l > r)
+            std::swap(l, r);
+        // il, ir are the left / right indices of vertical lines intersecting a segment
+        il = (l - x0) / line_spacing;
+        while (il * line_spacing + x0 < l)
+            ++ il;
+        il = std::max(int(0), il);
+        ir = (r - x0 + line_spacing) / line_spacing;
+        while (ir * line_spacing + x0 > r)
+            -- ir;
+        ir = std::min(int(n_vlines) - 1, ir);
+    };
+    // Count the intersections of each vertical line first to allocate the intersection vectors exactly
+    // instead of growing them by push_back(): Large regions produce many vertical lines with many intersections each.
+    {
+        // Difference array of the number of intersections: +1 at the first, -1 past the last vertical line intersected by a segment.
+        std::vector<int> num_intersections(n_vlines + 1, 0);
+        for (size_t iContour = 0; iContour < poly_with_offset.n_contours; ++ iContour) {
+            const Points &contour = poly_with_offset.contour(iContour).points;
+            if (contour.size() < 2)
+                continue;
+            for (size_t iSegment = 0, iPrev = contour.size() - 1; iSegment < contour.size(); iPrev = iSegment ++) {
+                int il, ir;
+                vertical_lines_range(contour[iPrev], contour[iSegment], il, ir);
+                if (il <= ir) {
+                    ++ num_intersections[il];
+                    -- num_intersections[ir + 1];
+                }
+            }
+        }
+        for (size_t i = 0, n = 0; i < n_vlines; ++ i) {
+            n += num_intersections[i];
+            segs[i].intersections.reserve(n);
+        }
+    }
     // For each contour
     for (size_t iContour = 0; iContour < poly_with_offset.n_contours; ++ iContour) {
         const Points &contour = poly_with_offset.contour(iContour).points;
@@ -782,32 +821,22 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
             const Point &p1 = contour[iPrev];
             const Point &p2 = contour[iSegment];
             // Which of the equally spaced vertical lines is intersected by this segment?
-            coord_t l = p1(0);
-            coord_t r = p2(0);
-            if (l > r)
-                std::swap(l, r);
-            // il, ir are the left / right indices of vertical lines intersecting a segment
-            int il = (l - x0) / line_spacing;
-            while (il * line_spacing + x0 < l)
-                ++ il;
-            il = std::max(int(0), il);
-            int ir = (r - x0 + line_spacing) / line_spacing;
-            while (ir * line_spacing + x0 > r)
-                -- ir;
-            ir = std::min(int(segs.size()) - 1, ir);
+            int il, ir;
+            vertical_lines_range(p1, p2, il, ir);
             if (il > ir)
                 // No vertical line intersects this segment.
                 continue;
             assert(il >= 0 && size_t(il) < segs.size());
             assert(ir >= 0 && size_t(ir) < segs.size());
+            const int64_t dy = int64_t(p2.y() - p1.y());
             for (int i = il; i <= ir; ++ i) {
                 coord_t this_x = segs[i].pos;
 				assert(this_x == i * line_spacing + x0);
                 SegmentIntersection is;
                 is.iContour = iContour;
                 is.iSegment = iSegment;
-                assert(l <= this_x);
-                assert(r >= this_x);
+                assert(std::min(p1.x(), p2.x()) <= this_x);
+                assert(std::max(p1.x(), p2.x()) >= this_x);
                 // Calculate the intersection position in y axis. x is known.
                 if (p1.x() == this_x) {
                     if (p2.x() == this_x) {
@@ -841,7 +870,7 @@ static std::vector<SegmentedIntersectionLine> slice_region_by_vertical_lines(con
                     assert(is.pos_q > 1);
                     assert(is.pos_p > 0 && is.pos_p < is.pos_q);
                     // Make an intersection point from the 't'.
-                    is.pos_p *= int64_t(p2.y() - p1.y());
+                    is.pos_p *= dy;
                     is.pos_p += p1.y() * int64_t(is.pos_q);
                 }
                 // +-1 to take rounding into account.
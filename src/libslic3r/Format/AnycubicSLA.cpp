@@ -9,6 +9,7 @@
 #include "SLA/RasterBase.hpp"
 #include "libslic3r/SLAPrint.hpp"
 
+#include <cstring>
 #include <sstream>
 #include <iostream>
 #include <fstream>
@@ -48,6 +49,17 @@ static void anycubicsla_get_pixel_span(const std::uint8_t* ptr, const std::uint8
     pixel = (*ptr) & 0xF0;
     // the maximum length of the span depends on the pixel color
     max_len = (pixel == 0 || pixel == 0xF0) ? 0xFFF : 0xF;
+    // test 8 pixels at once, the word continues the span if the high nibbles
+    // of all its bytes match the pixel
+    const std::uint64_t pattern = std::uint64_t(pixel) * 0x0101010101010101ull;
+    while (end - ptr >= 8 && span_len + 8 <= max_len) {
+        std::uint64_t word;
+        std::memcpy(&word, ptr, sizeof(word));
+        if (((word ^ pattern) & 0xF0F0F0F0F0F0F0F0ull) != 0)
+            break;
+        span_len += 8;
+        ptr += 8;
+    }
     while (ptr < end && span_len < max_len && ((*ptr) & 0xF0) == pixel) {
         span_len++;
         ptr++;
@@ -74,15 +86,12 @@ struct AnycubicSLARasterEncoder
             src += span_len;
             // fully transparent of fully opaque pixel
             if (pixel == 0 || pixel == 0xF0) {
-                pixel = pixel | (span_len >> 8);
-                std::copy(&pixel, (&pixel) + 1, std::back_inserter(dst));
-                pixel = span_len & 0xFF;
-                std::copy(&pixel, (&pixel) + 1, std::back_inserter(dst));
+                dst.emplace_back(std::uint8_t(pixel | (span_len >> 8)));
+                dst.emplace_back(std::uint8_t(span_len & 0xFF));
             }
             // antialiased pixel
             else {
-                pixel = pixel | span_len;
-                std::copy(&pixel, (&pixel) + 1, std::back_inserter(dst));
+                dst.emplace_back(std::uint8_t(pixel | span_len));
             }
         }
 
@@ -355,13 +355,16 @@ ExPolygons rings_to_expolygons(const std::vector<marchsq::Ring> &rings,
     return union_ex(polys);
 }
 
+// The layer images are inflated from the archive one by one and decoded and
+// converted to polygons in parallel, while at most a few images per thread
+// are held in memory.
 std::vector<ExPolygons> extract_slices_from_sla_archive(
-    ZipperArchive           &arch,
+    ZipperArchiveStream     &arch,
     const RasterParams      &rstp,
     const marchsq::Coord    &win,
     std::function<bool(int)> progr)
 {
-    std::vector<ExPolygons> slices(arch.entries.size());
+    std::vector<ExPolygons> slices(arch.entry_count());
 
     struct Status
     {
@@ -370,13 +373,12 @@ std::vector<ExPolygons> extract_slices_from_sla_archive(
         execution::SpinningMutex<ExecutionTBB> mutex = {};
     } st{100. / slices.size(), 0., 0.};
 
-    execution::for_each(
-        ex_tbb, size_t(0), arch.entries.size(),
-        [&arch, &slices, &st, &rstp, &win, progr](size_t i) {
+    arch.for_each_entry(
+        [&slices, &st, &rstp, &win, progr](size_t i, EntryBuffer &&entry) {
             // Status indication guarded with the spinlock
             {
                 std::lock_guard lck(st.mutex);
-                if (st.stop) return;
+                if (st.stop) return false;
 
                 st.val += st.incr;
                 double curr = std::round(st.val);
@@ -387,9 +389,11 @@ std::vector<ExPolygons> extract_slices_from_sla_archive(
             }
 
             png::ImageGreyscale img;
-            png::ReadBuf        rb{arch.entries[i].buf.data(),
-                            arch.entries[i].buf.size()};
-            if (!png::decode_png(rb, img)) return;
+            png::ReadBuf        rb{entry.buf.data(), entry.buf.size()};
+            if (!png::decode_png(rb, img)) return true;
+
+            // The compressed image is not needed anymore
+            entry.buf = {};
 
             constexpr uint8_t isoval = 128;
             auto              rings = marchsq::execute(img, isoval, win);
@@ -400,8 +404,10 @@ std::vector<ExPolygons> extract_slices_from_sla_archive(
             invert_raster_trafo(expolys, rstp.trafo, rstp.width, rstp.height);
 
             slices[i] = std::move(expolys);
+
+            return true;
         },
-        execution::max_concurrency(ex_tbb));
+        2 * execution::max_concurrency(ex_tbb));
 
     if (st.stop) slices = {};
 
@@ -430,8 +436,8 @@ ConfigSubstitutions SL1Reader::read(std::vector<ExPolygons> &slices,
 
     std::vector<std::string> includes = { "ini", "png"};
     std::vector<std::string> excludes = { "thumbnail" };
-    ZipperArchive arch = read_zipper_archive(m_fname, includes, excludes);
-    auto [profile_use, config_substitutions] = extract_profile(arch, profile_out);
+    ZipperArchiveStream arch(m_fname, includes, excludes);
+    auto [profile_use, config_substitutions] = extract_profile(arch.archive(), profile_out);
 
     RasterParams   rstp = get_raster_params(profile_use);
     marchsq::Coord win  = {windowsize.y(), windowsize.x()};
@@ -5,6 +5,8 @@
 #ifndef SLAARCHIVE_HPP
 #define SLAARCHIVE_HPP
 
+#include <chrono>
+#include <numeric>
 #include <vector>
 
 #include "libslic3r/SLA/RasterBase.hpp"
@@ -19,6 +21,8 @@ class SLAPrinterConfig;
 class SLAArchiveWriter {
 protected:
     std::vector<sla::EncodedRaster> m_layers;
+    // Time spent by encoding each layer, in seconds.
+    std::vector<double>             m_encoding_times;
 
     virtual std::unique_ptr<sla::RasterBase> create_raster() const = 0;
     virtual sla::RasterEncoder get_encoder() const = 0;
@@ -35,6 +39,7 @@ public:
         const EP & ep       = {})
     {
         m_layers.resize(layer_num);
+        m_encoding_times.assign(layer_num, 0.);
         execution::for_each(
             ep, size_t(0), m_layers.size(),
             [this, &drawfn, &cancelfn](size_t idx) {
@@ -43,11 +48,26 @@ public:
                 sla::EncodedRaster &enc = m_layers[idx];
                 auto                rst = create_raster();
                 drawfn(*rst, idx);
+                auto start = std::chrono::steady_clock::now();
                 enc = rst->encode(get_encoder());
+                m_encoding_times[idx] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
             },
             execution::max_concurrency(ep));
     }
 
+    // Total size of the encoded layer images in bytes.
+    size_t encoded_layers_size() const
+    {
+        return std::accumulate(m_layers.begin(), m_layers.end(), size_t(0),
+                               [](size_t sum, const sla::EncodedRaster &enc) { return sum + enc.size(); });
+    }
+
+    // Time spent by encoding the layer images in seconds, summed over all threads.
+    double layers_encoding_time() const
+    {
+        return std::accumulate(m_encoding_times.begin(), m_encoding_times.end(), 0.);
+    }
+
     // Export the print into an archive using the provided filename.
     virtual void export_print(const std::string     fname,
                               const SLAPrint       &print,
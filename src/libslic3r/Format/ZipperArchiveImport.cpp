@@ -8,10 +8,24 @@
 #include "libslic3r/Exception.hpp"
 #include "libslic3r/PrintConfig.hpp"
 
+#include <atomic>
+
 #include <boost/property_tree/ini_parser.hpp>
 #include <boost/filesystem/path.hpp>
 #include <boost/algorithm/string.hpp>
 
+// The pipeline interface differs between the old TBB and oneTBB, see GCode.cpp.
+#if ! defined(TBB_VERSION_MAJOR)
+    #include <tbb/version.h>
+#endif
+#if TBB_VERSION_MAJOR >= 2021
+    #include <tbb/parallel_pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter_mode;
+#else
+    #include <tbb/pipeline.h>
+    using slic3r_tbb_filtermode = tbb::filter;
+#endif
+
 namespace Slic3r {
 
 namespace {
@@ -46,6 +60,21 @@ EntryBuffer read_entry(const mz_zip_archive_file_stat &entry,
     return {std::move(buf), (name.empty() ? entry.m_filename : name)};
 }
 
+// Test the lowercase entry name against the include and exclude substrings.
+bool is_entry_included(const std::string              &name,
+                       const std::vector<std::string> &includes,
+                       const std::vector<std::string> &excludes)
+{
+    return std::any_of(includes.begin(), includes.end(),
+                       [&name](const std::string &incl) {
+                           return boost::algorithm::contains(name, incl);
+                       }) &&
+           !std::any_of(excludes.begin(), excludes.end(),
+                        [&name](const std::string &excl) {
+                            return boost::algorithm::contains(name, excl);
+                        });
+}
+
 } // namespace
 
 ZipperArchive read_zipper_archive(const std::string &zipfname,
@@ -75,16 +104,7 @@ ZipperArchive read_zipper_archive(const std::string &zipfname,
             std::string name = entry.m_filename;
             boost::algorithm::to_lower(name);
 
-            if (!std::any_of(includes.begin(), includes.end(),
-                            [&name](const std::string &incl) {
-                                return boost::algorithm::contains(name, incl);
-                            }))
-                continue;
-
-            if (std::any_of(excludes.begin(), excludes.end(),
-                            [&name](const std::string &excl) {
-                                return boost::algorithm::contains(name, excl);
-                            }))
+            if (!is_entry_included(name, includes, excludes))
                 continue;
 
             if (name == CONFIG_FNAME)  {
@@ -111,6 +131,82 @@ ZipperArchive read_zipper_archive(const std::string &zipfname,
     return arch;
 }
 
+ZipperArchiveStream::ZipperArchiveStream(const std::string              &zipfname,
+                                         const std::vector<std::string> &includes,
+                                         const std::vector<std::string> &excludes)
+    : m_zip(std::make_unique<MZ_Archive>())
+{
+    if (!open_zip_reader(&m_zip->arch, zipfname))
+        throw Slic3r::FileIOError(m_zip->get_errorstr());
+
+    try {
+        mz_uint num_entries = mz_zip_reader_get_num_files(&m_zip->arch);
+
+        for (mz_uint i = 0; i < num_entries; ++i) {
+            mz_zip_archive_file_stat entry;
+
+            if (mz_zip_reader_file_stat(&m_zip->arch, i, &entry)) {
+                std::string name = entry.m_filename;
+                boost::algorithm::to_lower(name);
+
+                if (!is_entry_included(name, includes, excludes))
+                    continue;
+
+                if (name == CONFIG_FNAME)
+                    m_arch.config = read_ini(entry, *m_zip);
+                else if (name == PROFILE_FNAME)
+                    m_arch.profile = read_ini(entry, *m_zip);
+                else
+                    m_entries.push_back({entry.m_file_index, size_t(entry.m_uncomp_size), name});
+            }
+        }
+    } catch (...) {
+        close_zip_reader(&m_zip->arch);
+        throw;
+    }
+
+    std::sort(m_entries.begin(), m_entries.end(),
+              [](const Entry &e1, const Entry &e2) { return e1.fname < e2.fname; });
+}
+
+ZipperArchiveStream::~ZipperArchiveStream()
+{
+    close_zip_reader(&m_zip->arch);
+}
+
+void ZipperArchiveStream::for_each_entry(const std::function<bool(size_t, EntryBuffer &&)> &entryfn,
+                                         size_t max_in_flight)
+{
+    using Item = std::pair<size_t, EntryBuffer>;
+
+    std::atomic<bool> stop = false;
+    size_t            next = 0;
+
+    auto inflate = tbb::make_filter<void, Item>(slic3r_tbb_filtermode::serial_in_order,
+        [this, &stop, &next](tbb::flow_control &fc) -> Item {
+            if (stop || next == m_entries.size()) {
+                fc.stop();
+                return {};
+            }
+
+            const Entry &entry = m_entries[next];
+            std::vector<uint8_t> buf(entry.size);
+            if (!mz_zip_reader_extract_to_mem(&m_zip->arch, entry.file_index,
+                                              buf.data(), buf.size(), 0))
+                throw Slic3r::FileIOError(m_zip->get_errorstr());
+
+            return {next ++, EntryBuffer{std::move(buf), entry.fname}};
+        });
+
+    auto process = tbb::make_filter<Item, void>(slic3r_tbb_filtermode::parallel,
+        [&entryfn, &stop](Item item) {
+            if (!stop && !entryfn(item.first, std::move(item.second)))
+                stop = true;
+        });
+
+    tbb::parallel_pipeline(std::max(max_in_flight, size_t(1)), inflate & process);
+}
+
 std::pair<DynamicPrintConfig, ConfigSubstitutions> extract_profile(
     const ZipperArchive &arch, DynamicPrintConfig &profile_out)
 {
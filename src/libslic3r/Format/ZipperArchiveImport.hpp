@@ -8,6 +8,8 @@
 #include <vector>
 #include <string>
 #include <cstdint>
+#include <functional>
+#include <memory>
 
 #include <boost/property_tree/ptree.hpp>
 
@@ -15,6 +17,8 @@
 
 namespace Slic3r {
 
+class MZ_Archive;
+
 // Buffer for arbitraryfiles inside a zipper archive.
 struct EntryBuffer
 {
@@ -45,6 +49,48 @@ ZipperArchive read_zipper_archive(const std::string &zipfname,
                                   const std::vector<std::string> &includes,
                                   const std::vector<std::string> &excludes);
 
+// Streaming counterpart of read_zipper_archive() for archives with many
+// large entries (layer images). The metadata is read up front, the other
+// entries are only indexed and they are inflated on demand by
+// for_each_entry(), so they never have to be in memory all at once.
+class ZipperArchiveStream
+{
+public:
+    // Same filtering as read_zipper_archive(). CONFIG_FNAME and PROFILE_FNAME
+    // are read into archive().config and archive().profile.
+    ZipperArchiveStream(const std::string              &zipfname,
+                        const std::vector<std::string> &includes,
+                        const std::vector<std::string> &excludes);
+    ~ZipperArchiveStream();
+
+    // Archive metadata, ZipperArchive::entries are left empty.
+    const ZipperArchive &archive() const { return m_arch; }
+
+    // Number of the indexed entries.
+    size_t entry_count() const { return m_entries.size(); }
+
+    // Inflate the indexed entries in the order of their names and pass them
+    // to entryfn(idx, entry) running in parallel on the worker threads, idx
+    // being the position of the entry in the name order. The entries are
+    // inflated sequentially, as the zip reader is not thread safe, while the
+    // previous ones are processed. At most max_in_flight entries are held in
+    // memory at a time. Stops early if entryfn returns false.
+    void for_each_entry(const std::function<bool(size_t, EntryBuffer &&)> &entryfn,
+                        size_t max_in_flight);
+
+private:
+    struct Entry
+    {
+        unsigned    file_index;
+        size_t      size;
+        std::string fname;
+    };
+
+    std::unique_ptr<MZ_Archive> m_zip;
+    ZipperArchive               m_arch;
+    std::vector<Entry>          m_entries;
+};
+
 // Extract the print profile form the archive into 'out'.
 // Returns a profile that has correct parameters to use for model reconstruction
 // even if the needed parameters were not fully found in the archive's metadata.
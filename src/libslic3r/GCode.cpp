@@ -181,6 +181,7 @@ namespace Slic3r {
 void GCodeGenerator::PlaceholderParserIntegration::reset()
 {
     this->failed_templates.clear();
+    this->compiled_templates.clear();
     this->output_config.clear();
     this->opt_position = nullptr;
     this->opt_zhop      = nullptr;
@@ -1278,9 +1279,12 @@ void GCodeGenerator::_do_export(Print& print, GCodeOutputStream &file, Thumbnail
             // Process all layers of a single object instance (sequential mode) with a parallel pipeline:
             // Generate G-code, run the filters (vase mode, cooling buffer), run the G-code analyser
             // and export G-code into file.
+            // The layers of an object are shared by all its instances, release them after the last instance was exported.
+            const bool last_instance = std::none_of(std::next(print_object_instance_sequential_active), print_object_instances_ordering.cend(),
+                [&object](const PrintInstance *instance) { return instance->print_object == &object; });
             this->process_layers(print, tool_ordering, collect_layers_to_print(object),
                 *print_object_instance_sequential_active - object.instances().data(),
-                smooth_path_cache_global, file);
+                smooth_path_cache_global, file, last_instance);
             ++ finished_objects;
             // Flag indicating whether the nozzle temperature changes from 1st to 2nd layer were performed.
             // Reset it when starting another object from 1st layer.
@@ -1448,6 +1452,23 @@ void GCodeGenerator::smooth_path_interpolate(
         out.interpolate_add(layer->support_fills, params);
 }
 
+// Release the extrusions of object and support layers, whose G-code has just been generated,
+// if requested by Print::set_release_layers_after_export(). The generation of the following layers
+// does not access the extrusions of the layers below. In sequential mode a layer is generated once
+// per instance of its object, the caller releases it with the last instance only.
+static void release_layers_after_export(const Print &print, const GCodeGenerator::ObjectsLayerToPrint &layers)
+{
+    if (! print.release_layers_after_export())
+        return;
+    // The layers are owned by the Print, which was passed to Print::export_gcode() as non-const.
+    for (const GCodeGenerator::ObjectLayerToPrint &layer : layers) {
+        if (layer.object_layer)
+            const_cast<Layer*>(layer.object_layer)->release_extrusions();
+        if (layer.support_layer)
+            const_cast<SupportLayer*>(layer.support_layer)->release_support_extrusions();
+    }
+}
+
 // Process all layers of all objects (non-sequential mode) with a parallel pipeline:
 // Generate G-code, run the filters (vase mode, cooling buffer), run the G-code analyser
 // and export G-code into file.
@@ -1495,9 +1516,11 @@ void GCodeGenerator::process_layers(
                 if (m_wipe_tower && layer_tools.has_wipe_tower)
                     m_wipe_tower->next_layer();
                 print.throw_if_canceled();
-                return this->process_layer(print, layer.second, layer_tools,
+                LayerResult result = this->process_layer(print, layer.second, layer_tools,
                     GCode::SmoothPathCaches{ smooth_path_cache_global, in.second },
                     &layer == &layers_to_print.back(), &print_object_instances_ordering, size_t(-1));
+                release_layers_after_export(print, layer.second);
+                return result;
             }
         });
     // The pipeline is variable: The vase mode filter is optional.
@@ -1519,7 +1542,8 @@ void GCodeGenerator::process_layers(
 
              return cooling_buffer->process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
         });
-    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    // Layers are independent strings at this point, thus they are searched / replaced in parallel.
+    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::parallel,
         [find_replace = this->m_find_replace.get()](std::string s) -> std::string {
             return find_replace->process_layer(std::move(s));
         });
@@ -1555,7 +1579,8 @@ void GCodeGenerator::process_layers(
     ObjectsLayerToPrint                      layers_to_print,
     const size_t                             single_object_idx,
     const GCode::SmoothPathCache            &smooth_path_cache_global,
-    GCodeOutputStream                       &output_stream)
+    GCodeOutputStream                       &output_stream,
+    const bool                               last_instance)
 {
     size_t layer_to_print_idx = 0;
     const GCode::SmoothPathCache::InterpolationParameters interpolation_params = interpolation_parameters(print.config());
@@ -1579,7 +1604,7 @@ void GCodeGenerator::process_layers(
             }
         });
     const auto generator = tbb::make_filter<std::pair<size_t, GCode::SmoothPathCache>, LayerResult>(slic3r_tbb_filtermode::serial_in_order,
-        [this, &print, &tool_ordering, &layers_to_print, &smooth_path_cache_global, single_object_idx](std::pair<size_t, GCode::SmoothPathCache> in) -> LayerResult {
+        [this, &print, &tool_ordering, &layers_to_print, &smooth_path_cache_global, single_object_idx, last_instance](std::pair<size_t, GCode::SmoothPathCache> in) -> LayerResult {
             size_t layer_to_print_idx = in.first;
             if (layer_to_print_idx == layers_to_print.size()) {
                 // Pressure equalizer need insert empty input. Because it returns one layer back.
@@ -1588,9 +1613,12 @@ void GCodeGenerator::process_layers(
             } else {
                 ObjectLayerToPrint &layer = layers_to_print[layer_to_print_idx];
                 print.throw_if_canceled();
-                return this->process_layer(print, { std::move(layer) }, tool_ordering.tools_for_layer(layer.print_z()),
+                LayerResult result = this->process_layer(print, { layer }, tool_ordering.tools_for_layer(layer.print_z()),
                     GCode::SmoothPathCaches{ smooth_path_cache_global, in.second },
                     &layer == &layers_to_print.back(), nullptr, single_object_idx);
+                if (last_instance)
+                    release_layers_after_export(print, { layer });
+                return result;
             }
         });
     // The pipeline is variable: The vase mode filter is optional.
@@ -1611,7 +1639,8 @@ void GCodeGenerator::process_layers(
                 return in.gcode;
             return cooling_buffer->process_layer(std::move(in.gcode), in.layer_id, in.cooling_buffer_flush);
         });
-    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::serial_in_order,
+    // Layers are independent strings at this point, thus they are searched / replaced in parallel.
+    const auto find_replace = tbb::make_filter<std::string, std::string>(slic3r_tbb_filtermode::parallel,
         [find_replace = this->m_find_replace.get()](std::string s) -> std::string {
             return find_replace->process_layer(std::move(s));
         });
@@ -1673,7 +1702,10 @@ std::string GCodeGenerator::placeholder_parser_process(
     PlaceholderParserIntegration &ppi = m_placeholder_parser_integration;
     try {
         ppi.update_from_gcodewriter(m_writer);
-        std::string output = ppi.parser.process(templ, current_extruder_id, config_override, &ppi.output_config, &ppi.context);
+        auto it_compiled = ppi.compiled_templates.find(templ);
+        if (it_compiled == ppi.compiled_templates.end())
+            it_compiled = ppi.compiled_templates.emplace(templ, PlaceholderParser::compile(templ)).first;
+        std::string output = ppi.parser.process(it_compiled->second, current_extruder_id, config_override, &ppi.output_config, &ppi.context);
         ppi.validate_output_vector_variables();
 
         if (const std::vector<double> &pos = ppi.opt_position->values; ppi.position != pos) {
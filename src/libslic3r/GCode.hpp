@@ -44,6 +44,7 @@
 #include <memory>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 //#include "GCode/PressureEqualizer.hpp"
 
@@ -244,13 +245,15 @@ private:
     // Process all layers of a single object instance (sequential mode) with a parallel pipeline:
     // Generate G-code, run the filters (vase mode, cooling buffer), run the G-code analyser
     // and export G-code into file.
+    // The layers may only be released after export if this is the last instance of the object to be printed.
     void process_layers(
         const Print                             &print,
         const ToolOrdering                      &tool_ordering,
         ObjectsLayerToPrint                      layers_to_print,
         const size_t                             single_object_idx,
         const GCode::SmoothPathCache            &smooth_path_cache_global,
-        GCodeOutputStream                       &output_stream);
+        GCodeOutputStream                       &output_stream,
+        const bool                               last_instance);
 
     void            set_last_pos(const Point &pos) { m_last_pos = pos; m_last_pos_defined = true; }
     bool            last_pos_defined() const { return m_last_pos_defined; }
@@ -336,6 +339,9 @@ private:
         PlaceholderParser::ContextData      context;
         // Collection of templates, on which the placeholder substitution failed.
         std::map<std::string, std::string>  failed_templates;
+        // Templates compiled on their first use, keyed by the template text.
+        // Layer change G-codes are evaluated once per layer, thus their plain text is not re-parsed over and over.
+        std::unordered_map<std::string, PlaceholderParser::CompiledTemplate> compiled_templates;
         // Input/output from/to custom G-code block, for returning position, retraction etc.
         DynamicConfig                       output_config;
         ConfigOptionFloats                 *opt_position { nullptr };
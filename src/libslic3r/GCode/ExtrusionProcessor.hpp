@@ -88,18 +88,22 @@ std::vector<ExtendedPoint> estimate_points_properties(const POINTS
     std::vector<ExtendedPoint> points;
     points.reserve(input_points.size() * (ADD_INTERSECTIONS ? 1.5 : 1));
 
+    // Nearest line of the previous point, bounds the search for the nearest line of the next point.
+    size_t nearest_line_hint = size_t(-1);
     {
         ExtendedPoint start_point{maybe_unscale(input_points.front())};
         auto [distance, nearest_line,
               x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(start_point.position.cast<AABBScalar>());
         start_point.distance = distance + boundary_offset;
+        nearest_line_hint    = nearest_line;
         points.push_back(start_point);
     }
     for (size_t i = 1; i < input_points.size(); i++) {
         ExtendedPoint next_point{maybe_unscale(input_points[i])};
         auto [distance, nearest_line,
-              x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(next_point.position.cast<AABBScalar>());
+              x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(next_point.position.cast<AABBScalar>(), nearest_line_hint);
         next_point.distance = distance + boundary_offset;
+        nearest_line_hint   = nearest_line;
 
         if (ADD_INTERSECTIONS &&
             ((points.back().distance > boundary_offset + EPSILON) != (next_point.distance > boundary_offset + EPSILON))) {
@@ -136,7 +140,8 @@ std::vector<ExtendedPoint> estimate_points_properties(const POINTS
                     if (t0 < 1.0) {
                         auto p0     = curr.position + t0 * (next.position - curr.position);
                         auto [p0_dist, p0_near_l,
-                              p0_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(p0.cast<AABBScalar>());
+                              p0_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(p0.cast<AABBScalar>(), nearest_line_hint);
+                        nearest_line_hint = p0_near_l;
                         ExtendedPoint new_p{};
                         new_p.position = p0;
                         new_p.distance = float(p0_dist + boundary_offset);
@@ -145,7 +150,8 @@ std::vector<ExtendedPoint> estimate_points_properties(const POINTS
                     if (t1 > 0.0) {
                         auto p1     = curr.position + t1 * (next.position - curr.position);
                         auto [p1_dist, p1_near_l,
-                              p1_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(p1.cast<AABBScalar>());
+                              p1_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(p1.cast<AABBScalar>(), nearest_line_hint);
+                        nearest_line_hint = p1_near_l;
                         ExtendedPoint new_p{};
                         new_p.position = p1;
                         new_p.distance = float(p1_dist + boundary_offset);
@@ -172,7 +178,8 @@ std::vector<ExtendedPoint> estimate_points_properties(const POINTS
                 for (size_t j = 1; j < new_point_count + 1; j++) {
                     Vec2d pos  = curr.position * (1.0 - j * t) + next.position * (j * t);
                     auto [p_dist, p_near_l,
-                          p_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(pos.cast<AABBScalar>());
+                          p_x] = unscaled_prev_layer.template distance_from_lines_extra<SIGNED_DISTANCE>(pos.cast<AABBScalar>(), nearest_line_hint);
+                    nearest_line_hint = p_near_l;
                     ExtendedPoint new_p{};
                     new_p.position = pos;
                     new_p.distance = float(p_dist + boundary_offset);
@@ -57,6 +57,39 @@ GCodeFindReplace::GCodeFindReplace(const std::vector<std::string> &gcode_substit
         }
         m_substitutions.emplace_back(std::move(out));
     }
+
+    // Only plain case sensitive substitutions are matched by the multi-pattern pass.
+    auto multi_pattern_compatible = [](const Substitution &s) {
+        return ! s.regexp && ! s.case_insensitive && ! s.whole_word && ! s.plain_pattern.empty() && ! s.format.empty();
+    };
+    // Could an occurrence of a overlap an occurrence of b? True if one contains the other
+    // or if a suffix of one is a prefix of the other.
+    auto may_overlap = [](const std::string &a, const std::string &b) {
+        if (a.find(b) != std::string::npos || b.find(a) != std::string::npos)
+            return true;
+        for (size_t len = 1; len < std::min(a.size(), b.size()); ++ len)
+            if (a.compare(a.size() - len, len, b, 0, len) == 0 || b.compare(b.size() - len, len, a, 0, len) == 0)
+                return true;
+        return false;
+    };
+    for (size_t i = 0; i < m_substitutions.size();) {
+        size_t j = i + 1;
+        if (multi_pattern_compatible(m_substitutions[i]))
+            // A substitution may be merged with the preceding ones if its pattern cannot overlap their patterns,
+            // and if it cannot match any text produced by their replacements.
+            for (; j < m_substitutions.size() && multi_pattern_compatible(m_substitutions[j]) &&
+                   std::none_of(m_substitutions.begin() + i, m_substitutions.begin() + j, [&may_overlap, &next = m_substitutions[j]](const Substitution &prev) {
+                       return may_overlap(prev.plain_pattern, next.plain_pattern) || may_overlap(prev.format, next.plain_pattern);
+                   }); ++ j) ;
+        Pass pass { i, j, {} };
+        if (j - i > 1) {
+            pass.by_first_char.assign(256, {});
+            for (size_t k = i; k < j; ++ k)
+                pass.by_first_char[static_cast<unsigned char>(m_substitutions[k].plain_pattern.front())].emplace_back(k);
+        }
+        m_passes.emplace_back(std::move(pass));
+        i = j;
+    }
 }
 
 class ToStringIterator 
@@ -109,14 +142,50 @@ static void find_and_replace_whole_word(std::string &inout, const std::string &m
     }
 }
 
-std::string GCodeFindReplace::process_layer(const std::string &ain)
+void GCodeFindReplace::apply_multi_pattern(const Pass &pass, std::string &inout) const
+{
+    std::string out;
+    // End of the last replaced match.
+    size_t      k = 0;
+    for (size_t i = 0; i < inout.size();) {
+        const Substitution *match = nullptr;
+        // The patterns of a single pass do not overlap, thus at most one of them matches at i.
+        for (size_t idx : pass.by_first_char[static_cast<unsigned char>(inout[i])])
+            if (const Substitution &substitution = m_substitutions[idx]; inout.compare(i, substitution.plain_pattern.size(), substitution.plain_pattern) == 0) {
+                match = &substitution;
+                break;
+            }
+        if (match) {
+            if (k == 0)
+                out.reserve(inout.size());
+            out.append(inout, k, i - k);
+            out.append(match->format);
+            i = k = i + match->plain_pattern.size();
+        } else
+            ++ i;
+    }
+    if (k > 0) {
+        out.append(inout, k, inout.size() - k);
+        inout.swap(out);
+    }
+}
+
+std::string GCodeFindReplace::process_layer(const std::string &ain) const
 {
     std::string out;
     const std::string *in = &ain;
     std::string temp;
     temp.reserve(in->size());
 
-    for (const Substitution &substitution : m_substitutions) {
+    for (const Pass &pass : m_passes) {
+        if (pass.multi_pattern()) {
+            if (in == &ain)
+                out = ain;
+            this->apply_multi_pattern(pass, out);
+            in = &out;
+            continue;
+        }
+        const Substitution &substitution = m_substitutions[pass.begin];
         if (substitution.regexp) {
             temp.clear();
             temp.reserve(in->size());
@@ -17,7 +17,8 @@ public:
     GCodeFindReplace(const std::vector<std::string> &gcode_substitutions);
 
 
-    std::string process_layer(const std::string &gcode);
+    // Thread safe, layers may be processed in parallel.
+    std::string process_layer(const std::string &gcode) const;
     
 private:
     struct Substitution {
@@ -32,6 +33,22 @@ private:
         bool            single_line { false };
     };
     std::vector<Substitution> m_substitutions;
+
+    // Substitutions are applied in passes over a layer. A pass either applies a single substitution,
+    // or it applies a run of plain case sensitive substitutions at once, if these substitutions
+    // do not interfere with each other, thus applying them in a single pass is equivalent to applying them one by one.
+    struct Pass {
+        // Range of m_substitutions applied by this pass.
+        size_t                              begin;
+        size_t                              end;
+        // For a multi-pattern pass: indices of substitutions indexed by the first character of their pattern.
+        std::vector<std::vector<size_t>>    by_first_char;
+
+        bool multi_pattern() const { return ! by_first_char.empty(); }
+    };
+    std::vector<Pass>         m_passes;
+
+    void        apply_multi_pattern(const Pass &pass, std::string &inout) const;
 };
 
 }
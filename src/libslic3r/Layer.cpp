@@ -1054,6 +1054,23 @@ void Layer::sort_perimeters_into_islands(
     }
 }
 
+void Layer::release_extrusions()
+{
+    for (LayerRegion *layerm : m_regions) {
+        layerm->m_perimeters.clear();
+        layerm->m_thin_fills.clear();
+        layerm->m_fills.clear();
+        layerm->m_fill_surfaces.clear();
+        layerm->m_fill_expolygons.clear();
+        layerm->m_fill_expolygons_bboxes.clear();
+        layerm->m_fill_expolygons_composite.clear();
+        layerm->m_fill_expolygons_composite_bboxes.clear();
+    }
+    // The islands index the released extrusions.
+    for (LayerSlice &lslice : this->lslices_ex)
+        lslice.islands.clear();
+}
+
 void Layer::export_region_slices_to_svg(const char *path) const
 {
     BoundingBox bbox;
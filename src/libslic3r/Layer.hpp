@@ -39,6 +39,8 @@ namespace FillLightning {
     class Generator;
 };
 
+class PlanePathCurves;
+
 // Range of indices, providing support for range based loops.
 template<typename T>
 class IndexRange
@@ -379,14 +381,18 @@ public:
     }
     void                    make_perimeters();
     // Phony version of make_fills() without parameters for Perl integration only.
-    void                    make_fills() { this->make_fills(nullptr, nullptr, nullptr); }
+    void                    make_fills() { this->make_fills(nullptr, nullptr, nullptr, nullptr); }
     void                    make_fills(FillAdaptive::Octree     *adaptive_fill_octree,
                                        FillAdaptive::Octree     *support_fill_octree,
-                                       FillLightning::Generator *lightning_generator);
+                                       FillLightning::Generator *lightning_generator,
+                                       PlanePathCurves          *plane_path_curves);
     Polylines               generate_sparse_infill_polylines_for_anchoring(FillAdaptive::Octree *adaptive_fill_octree,
                                                                            FillAdaptive::Octree *support_fill_octree,
                                                                            FillLightning::Generator* lightning_generator) const;
     void 					make_ironing();
+    // Release the extrusions of this layer after its G-code was generated, see Print::set_release_layers_after_export().
+    // The layer cannot be exported again.
+    void                    release_extrusions();
 
     void                    export_region_slices_to_svg(const char *path) const;
     void                    export_region_fill_surfaces_to_svg(const char *path) const;
@@ -449,6 +455,8 @@ public:
 
     // Is there any valid extrusion assigned to this LayerRegion?
     virtual bool                has_extrusions() const { return ! support_fills.empty(); }
+    // Release the support extrusions after the G-code of this layer was generated, see Print::set_release_layers_after_export().
+    void                        release_support_extrusions() { support_fills.clear(); }
 
     // Zero based index of an interface layer, used for alternating direction of interface / contact layers.
     size_t                      interface_id() const { return m_interface_id; }
@@ -85,24 +85,45 @@ struct PaintedLine
     int    color;
 };
 
+// Collects segments of EdgeGrid contours lying close to a projected painted line.
+// A single visitor is reused for many painted lines to not allocate its internal buffers over and over,
+// the collected segments are moved to the shared painted_lines of a layer under a lock once per painted line.
 struct PaintedLineVisitor
 {
-    PaintedLineVisitor(const EdgeGrid::Grid &grid, std::vector<PaintedLine> &painted_lines, std::mutex &painted_lines_mutex, size_t reserve) : grid(grid), painted_lines(painted_lines), painted_lines_mutex(painted_lines_mutex)
+    PaintedLineVisitor(size_t reserve)
     {
         painted_lines_set.reserve(reserve);
+        painted_lines_local.reserve(reserve);
     }
 
-    void reset() { painted_lines_set.clear(); }
+    // Prepare for processing of a new painted line, keep the allocated buffers.
+    void reset(const EdgeGrid::Grid &grid, const Line &line_to_test, int color)
+    {
+        this->grid         = &grid;
+        this->line_to_test = line_to_test;
+        this->color        = color;
+        painted_lines_set.clear();
+        painted_lines_local.clear();
+    }
+
+    // Move the collected segments to the output.
+    void flush(std::vector<PaintedLine> &painted_lines, std::mutex &painted_lines_mutex)
+    {
+        if (! painted_lines_local.empty()) {
+            boost::lock_guard<std::mutex> lock(painted_lines_mutex);
+            painted_lines.insert(painted_lines.end(), painted_lines_local.begin(), painted_lines_local.end());
+        }
+    }
 
     bool operator()(coord_t iy, coord_t ix)
     {
         // Called with a row and column of the grid cell, which is intersected by a line.
-        auto         cell_data_range        = grid.cell_data_range(iy, ix);
+        auto         cell_data_range        = grid->cell_data_range(iy, ix);
         const Vec2d  v1                     = line_to_test.vector().cast<double>();
         const double v1_sqr_norm            = v1.squaredNorm();
         const double heuristic_thr_part     = line_to_test.length() + append_threshold;
         for (auto it_contour_and_segment = cell_data_range.first; it_contour_and_segment != cell_data_range.second; ++it_contour_and_segment) {
-            Line        grid_line         = grid.line(*it_contour_and_segment);
+            Line        grid_line         = grid->line(*it_contour_and_segment);
             const Vec2d v2                = grid_line.vector().cast<double>();
             double      heuristic_thr_sqr = Slic3r::sqr(heuristic_thr_part + grid_line.length());
 
@@ -129,10 +150,7 @@ struct PaintedLineVisitor
                             line_to_test_projected.reverse();
 
                         painted_lines_set.insert(*it_contour_and_segment);
-                        {
-                            boost::lock_guard<std::mutex> lock(painted_lines_mutex);
-                            painted_lines.push_back({it_contour_and_segment->first, it_contour_and_segment->second, line_to_test_projected, this->color});
-                        }
+                        painted_lines_local.push_back({it_contour_and_segment->first, it_contour_and_segment->second, line_to_test_projected, this->color});
                     }
                 }
             }
@@ -141,11 +159,10 @@ struct PaintedLineVisitor
         return true;
     }
 
-    const EdgeGrid::Grid                                                                 &grid;
-    std::vector<PaintedLine>                                                             &painted_lines;
-    std::mutex                                                                           &painted_lines_mutex;
+    const EdgeGrid::Grid                                                                 *grid              = nullptr;
     Line                                                                                  line_to_test;
     std::unordered_set<std::pair<size_t, size_t>, boost::hash<std::pair<size_t, size_t>>> painted_lines_set;
+    std::vector<PaintedLine>                                                              painted_lines_local;
     int                                                                                   color             = -1;
 
     static inline const double                                                            cos_threshold2    = Slic3r::sqr(cos(M_PI * 30. / 180.));
@@ -1745,19 +1762,22 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
         layer_bboxes[layer_idx].merge(get_extents(input_expolygons[layer_idx]));
     }
 
-    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx) {
-        throw_on_cancel_callback();
-        BoundingBox bbox = layer_bboxes[layer_idx];
-        // Projected triangles could, in rare cases (as in GH issue #7299), belongs to polygons printed in the previous or the next layer.
-        // Let's merge the bounding box of the current layer with bounding boxes of the previous and the next layer to ensure that
-        // every projected triangle will be inside the resulting bounding box.
-        if (layer_idx > 1) bbox.merge(layer_bboxes[layer_idx - 1]);
-        if (layer_idx < num_layers - 1) bbox.merge(layer_bboxes[layer_idx + 1]);
-        // Projected triangles may slightly exceed the input polygons.
-        bbox.offset(20 * SCALED_EPSILON);
-        edge_grids[layer_idx].set_bbox(bbox);
-        edge_grids[layer_idx].create(input_expolygons[layer_idx], coord_t(scale_(10.)));
-    }
+    // EdgeGrids of all layers are independent, build them in parallel.
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&layer_bboxes, &edge_grids, &input_expolygons, &num_layers, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
+            throw_on_cancel_callback();
+            BoundingBox bbox = layer_bboxes[layer_idx];
+            // Projected triangles could, in rare cases (as in GH issue #7299), belongs to polygons printed in the previous or the next layer.
+            // Let's merge the bounding box of the current layer with bounding boxes of the previous and the next layer to ensure that
+            // every projected triangle will be inside the resulting bounding box.
+            if (layer_idx > 1) bbox.merge(layer_bboxes[layer_idx - 1]);
+            if (layer_idx < num_layers - 1) bbox.merge(layer_bboxes[layer_idx + 1]);
+            // Projected triangles may slightly exceed the input polygons.
+            bbox.offset(20 * SCALED_EPSILON);
+            edge_grids[layer_idx].set_bbox(bbox);
+            edge_grids[layer_idx].create(input_expolygons[layer_idx], coord_t(scale_(10.)));
+        }
+    }); // end of parallel_for
 
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - projection of painted triangles - begin";
     for (const ModelVolume *mv : print_object.model_object()->volumes) {
@@ -1770,6 +1790,8 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
 
                 const Transform3f tr = print_object.trafo().cast<float>() * mv->get_matrix().cast<float>();
                 tbb::parallel_for(tbb::blocked_range<size_t>(0, custom_facets.indices.size()), [&tr, &custom_facets, &print_object, &layers, &edge_grids, &input_expolygons, &painted_lines, &painted_lines_mutex, &extruder_idx](const tbb::blocked_range<size_t> &range) {
+                    // One visitor serves all facets of this range.
+                    PaintedLineVisitor visitor(16);
                     for (size_t facet_idx = range.begin(); facet_idx < range.end(); ++facet_idx) {
                         float min_z = std::numeric_limits<float>::max();
                         float max_z = std::numeric_limits<float>::lowest();
@@ -1830,10 +1852,9 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
                             size_t mutex_idx = layer_idx & 0x3F;
                             assert(mutex_idx < painted_lines_mutex.size());
 
-                            PaintedLineVisitor visitor(edge_grids[layer_idx], painted_lines[layer_idx], painted_lines_mutex[mutex_idx], 16);
-                            visitor.line_to_test = line_to_test;
-                            visitor.color        = int(extruder_idx);
+                            visitor.reset(edge_grids[layer_idx], line_to_test, int(extruder_idx));
                             edge_grids[layer_idx].visit_cells_intersecting_line(line_to_test.a, line_to_test.b, visitor);
+                            visitor.flush(painted_lines[layer_idx], painted_lines_mutex[mutex_idx]);
                         }
                     }
                 }); // end of parallel_for
@@ -1844,10 +1865,18 @@ std::vector<std::vector<ExPolygons>> multi_material_segmentation_by_painting(con
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - painted layers count: "
                              << std::count_if(painted_lines.begin(), painted_lines.end(), [](const std::vector<PaintedLine> &pl) { return !pl.empty(); });
 
+    // Only the painted layers are segmented, and the cost of segmenting a layer varies a lot with the complexity of its painting.
+    // Distribute the painted layers one by one, so that a few complex layers do not end up in a single task.
+    std::vector<size_t> painted_layers;
+    for (size_t layer_idx = 0; layer_idx < num_layers; ++layer_idx)
+        if (!painted_lines[layer_idx].empty())
+            painted_layers.emplace_back(layer_idx);
+
     BOOST_LOG_TRIVIAL(debug) << "MMU segmentation - layers segmentation in parallel - begin";
-    tbb::parallel_for(tbb::blocked_range<size_t>(0, num_layers), [&edge_grids, &input_expolygons, &painted_lines, &segmented_regions, &num_extruders, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
-        for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++layer_idx) {
+    tbb::parallel_for(tbb::blocked_range<size_t>(0, painted_layers.size(), 1), [&painted_layers, &edge_grids, &input_expolygons, &painted_lines, &segmented_regions, &num_extruders, &throw_on_cancel_callback](const tbb::blocked_range<size_t> &range) {
+        for (size_t painted_layer_idx = range.begin(); painted_layer_idx < range.end(); ++painted_layer_idx) {
             throw_on_cancel_callback();
+            const size_t layer_idx = painted_layers[painted_layer_idx];
             if (!painted_lines[layer_idx].empty()) {
 #ifdef MMU_SEGMENTATION_DEBUG_PAINTED_LINES
                 {
@@ -285,6 +285,11 @@ float get_voxel_scale(const VoxelGrid &vgrid)
     return scale;
 }
 
+size_t grid_memory_usage(const VoxelGrid &vgrid)
+{
+    return size_t(vgrid.grid.memUsage());
+}
+
 VoxelGridPtr clone(const VoxelGrid &grid)
 {
     return make_voxelgrid(grid);
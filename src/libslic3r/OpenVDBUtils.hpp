@@ -25,6 +25,9 @@ double get_distance_raw(const Vec3f &p, const VoxelGrid &interior);
 
 float get_voxel_scale(const VoxelGrid &grid);
 
+// Memory allocated by the grid tree in bytes.
+size_t grid_memory_usage(const VoxelGrid &grid);
+
 VoxelGridPtr clone(const VoxelGrid &grid);
 
 class MeshToGridParams {
@@ -10,6 +10,7 @@
 #include "Exception.hpp"
 #include "Flow.hpp"
 #include "Utils.hpp"
+#include <cctype>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
@@ -801,6 +802,9 @@ namespace client
         // If true, the macro processor will evaluate just a boolean condition using the full expressive power of the macro processor.
         bool                     just_boolean_expression = false;
         std::string              error_message;
+        // If the macro processor parses just a segment of a compiled template, the whole template is referenced here
+        // to report the error line and column relative to the complete template.
+        const std::string       *error_context          = nullptr;
 
         // Table to translate symbol tag to a human readable error message.
         static std::map<std::string, std::string> tag_to_error_message;
@@ -1573,8 +1577,8 @@ namespace client
         static void process_error_message(const MyContext *context, const boost::spirit::info &info, const Iterator &it_begin, const Iterator &it_end, const Iterator &it_error)
         {
             std::string &msg = const_cast<MyContext*>(context)->error_message;
-            std::string  first(it_begin, it_error);
-            std::string  last(it_error, it_end);
+            std::string  first(context->error_context ? context->error_context->cbegin() : it_begin, it_error);
+            std::string  last(it_error, context->error_context ? context->error_context->cend() : it_end);
             auto         first_pos  = first.rfind('\n');
             auto         last_pos   = last.find('\n');
             int          line_nr    = 1;
@@ -1589,7 +1593,7 @@ namespace client
             }
             auto error_line = std::string(first, first_pos) + std::string(last, 0, last_pos);
             // Position of the it_error from the start of its line.
-            auto error_pos  = (it_error - it_begin) - first_pos;
+            auto error_pos  = first.size() - first_pos;
             msg += "Parsing error at line " + std::to_string(line_nr);
             if (! info.tag.empty() && info.tag.front() == '*') {
                 // The gat contains an explanatory string.
@@ -2338,10 +2342,10 @@ namespace client
 
 static const client::macro_processor g_macro_processor_instance;
 
-static std::string process_macro(const std::string &templ, client::MyContext &context)
+static std::string process_macro(std::string::const_iterator begin, std::string::const_iterator end, client::MyContext &context)
 {
     std::string output;
-    phrase_parse(templ.begin(), templ.end(), g_macro_processor_instance(&context), client::skipper{}, output);
+    phrase_parse(begin, end, g_macro_processor_instance(&context), client::skipper{}, output);
 	if (! context.error_message.empty()) {
         if (context.error_message.back() != '\n' && context.error_message.back() != '\r')
             context.error_message += '\n';
@@ -2350,6 +2354,129 @@ static std::string process_macro(const std::string &templ, client::MyContext &co
     return output;
 }
 
+static std::string process_macro(const std::string &templ, client::MyContext &context)
+{
+    return process_macro(templ.begin(), templ.end(), context);
+}
+
+// Validate a run of plain text the same way client::utf8_char_parser does, so that a compiled template
+// fails on exactly the same inputs as the full macro processor.
+static bool valid_utf8(std::string::const_iterator it, std::string::const_iterator end)
+{
+    while (it != end) {
+        unsigned char c = static_cast<unsigned char>(*it ++);
+        if ((c & 0xC0) == 0x80)
+            return false;
+        unsigned int cnt = 0;
+        for (unsigned char mask = 0x80u; c & mask; mask >>= 1)
+            ++ cnt;
+        cnt = (cnt == 0) ? 1 : std::min(cnt, 4u);
+        for (-- cnt; cnt > 0; -- cnt) {
+            if (it == end)
+                return false;
+            c = static_cast<unsigned char>(*it ++);
+            if (cnt > 1 && (c & 0xC0) != 0x80)
+                return false;
+        }
+    }
+    return true;
+}
+
+// Find the end of a legacy [variable] or [variable_[index]] expansion starting at templ[begin] == '['.
+// Returns std::string::npos if the brackets are not balanced.
+static size_t legacy_expansion_end(const std::string &templ, size_t begin)
+{
+    assert(templ[begin] == '[');
+    int depth = 0;
+    for (size_t i = begin; i < templ.size(); ++ i)
+        if (templ[i] == '[')
+            ++ depth;
+        else if (templ[i] == ']' && -- depth == 0)
+            return i + 1;
+        else if (templ[i] == '{')
+            break;
+    return std::string::npos;
+}
+
+// Find the end of a {} macro block starting at templ[begin] == '{', if the block may be evaluated on its own.
+// Blocks opening or closing an {if}...{endif} spanning multiple {} pairs are not self-contained,
+// for those std::string::npos is returned, as well as for blocks with unbalanced braces.
+static size_t self_contained_macro_end(const std::string &templ, size_t begin)
+{
+    assert(templ[begin] == '{');
+    int  if_depth        = 0;
+    bool regex_expected  = false;
+    for (size_t i = begin + 1; i < templ.size();) {
+        char c = templ[i];
+        if (c == '}')
+            return if_depth == 0 ? i + 1 : std::string::npos;
+        if (c == '{')
+            return std::string::npos;
+        if (c == '"' || (c == '/' && regex_expected)) {
+            // Skip a string literal or a regular expression, both with backslash escapes.
+            for (++ i; i < templ.size() && templ[i] != c; ++ i)
+                if (templ[i] == '\\')
+                    ++ i;
+            if (i >= templ.size())
+                return std::string::npos;
+            ++ i;
+            regex_expected = false;
+        } else if (c == '_' || std::isalpha(static_cast<unsigned char>(c))) {
+            size_t j = i;
+            while (j < templ.size() && (templ[j] == '_' || std::isalnum(static_cast<unsigned char>(templ[j]))))
+                ++ j;
+            std::string_view kw(templ.data() + i, j - i);
+            if (kw == "if")
+                ++ if_depth;
+            else if (kw == "endif") {
+                if (-- if_depth < 0)
+                    return std::string::npos;
+            } else if ((kw == "elsif" || kw == "else") && if_depth == 0)
+                return std::string::npos;
+            i = j;
+            regex_expected = false;
+        } else if ((c == '=' || c == '!') && i + 1 < templ.size() && templ[i + 1] == '~') {
+            i += 2;
+            regex_expected = true;
+        } else {
+            if (c != ' ' && c != '\t' && c != '\r' && c != '\n')
+                regex_expected = false;
+            ++ i;
+        }
+    }
+    return std::string::npos;
+}
+
+PlaceholderParser::CompiledTemplate PlaceholderParser::compile(const std::string &templ)
+{
+    CompiledTemplate out;
+    out.m_source = templ;
+    for (size_t i = 0; i < templ.size();) {
+        size_t j = templ.find_first_of("[{", i);
+        if (j == std::string::npos)
+            j = templ.size();
+        if (j > i) {
+            if (! valid_utf8(templ.begin() + i, templ.begin() + j))
+                break;
+            out.m_segments.push_back({ i, j, true });
+            i = j;
+        } else {
+            j = templ[i] == '[' ? legacy_expansion_end(templ, i) : self_contained_macro_end(templ, i);
+            if (j == std::string::npos)
+                break;
+            out.m_segments.push_back({ i, j, false });
+            i = j;
+        }
+        if (i == templ.size())
+            return out;
+    }
+    // The template could not be split into independent segments, it will be processed by the macro processor as a whole.
+    out.m_segments.clear();
+    if (! templ.empty())
+        out.m_segments.push_back({ 0, templ.size(), false });
+    return out;
+}
+
 std::string PlaceholderParser::process(const std::string &templ, unsigned int current_extruder_id, const DynamicConfig *config_override, DynamicConfig *config_outputs, ContextData *context_data) const
 {
     client::MyContext context;
@@ -2362,6 +2489,32 @@ std::string PlaceholderParser::process(const std::string &templ, unsigned int cu
     return process_macro(templ, context);
 }
 
+std::string PlaceholderParser::process(const CompiledTemplate &templ, unsigned int current_extruder_id, const DynamicConfig *config_override, DynamicConfig *config_outputs, ContextData *context_data) const
+{
+    const std::string &src = templ.source();
+    std::string        output;
+    if (templ.m_segments.size() == 1 && templ.m_segments.front().plain_text)
+        // Shortcut: No macro at all.
+        return src;
+    client::MyContext context;
+    context.external_config 	= this->external_config();
+    context.config              = &this->config();
+    context.config_override     = config_override;
+    context.config_outputs      = config_outputs;
+    context.current_extruder_id = current_extruder_id;
+    context.context_data        = context_data;
+    context.error_context       = &src;
+    output.reserve(src.size());
+    // All segments share a single context, thus local variables defined by one segment are visible to the following segments
+    // the same way as if the template was processed at once.
+    for (const CompiledTemplate::Segment &segment : templ.m_segments)
+        if (segment.plain_text)
+            output.append(src, segment.begin, segment.end - segment.begin);
+        else
+            output += process_macro(src.begin() + segment.begin, src.begin() + segment.end, context);
+    return output;
+}
+
 // Evaluate a boolean expression using the full expressive power of the PlaceholderParser boolean expression syntax.
 // Throws Slic3r::RuntimeError on syntax or runtime error.
 bool PlaceholderParser::evaluate_boolean_expression(const std::string &templ, const DynamicConfig &config, const DynamicConfig *config_override)
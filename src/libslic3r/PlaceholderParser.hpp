@@ -31,6 +31,26 @@ public:
         std::unique_ptr<DynamicConfig>  global_config;
     };
 
+    // Template split into runs of plain text and self-contained macro blocks. The plain text is copied to the output
+    // verbatim, only the macro blocks are evaluated by the macro processor. Macro blocks spanning multiple {} pairs
+    // ({if}...{else}...{endif}) are kept together. A template is compiled once by PlaceholderParser::compile()
+    // to be evaluated many times (for example a layer change G-code) by PlaceholderParser::process().
+    class CompiledTemplate {
+    public:
+        const std::string&  source() const { return m_source; }
+        bool                empty() const { return m_source.empty(); }
+
+    private:
+        friend class PlaceholderParser;
+        struct Segment {
+            size_t  begin;
+            size_t  end;
+            bool    plain_text;
+        };
+        std::string             m_source;
+        std::vector<Segment>    m_segments;
+    };
+
     PlaceholderParser(const DynamicConfig *external_config = nullptr);
     
     void clear_config() { m_config.clear(); }
@@ -67,6 +87,11 @@ public:
     std::string process(const std::string &templ, unsigned int current_extruder_id = 0, const DynamicConfig *config_override = nullptr, ContextData *context = nullptr) const
         { return this->process(templ, current_extruder_id, config_override, nullptr /* config_outputs */, context); }
 
+    // Split the template into plain text and macro blocks. Does not throw, syntax errors are reported by process().
+    static CompiledTemplate compile(const std::string &templ);
+    // Fill in a compiled template. Produces the same output and the same error messages as process() on the template source.
+    std::string process(const CompiledTemplate &templ, unsigned int current_extruder_id, const DynamicConfig *config_override, DynamicConfig *config_outputs, ContextData *context) const;
+
     // Evaluate a boolean expression using the full expressive power of the PlaceholderParser boolean expression syntax.
     // Throws Slic3r::PlaceholderParserError on syntax or runtime error.
     static bool evaluate_boolean_expression(const std::string &templ, const DynamicConfig &config, const DynamicConfig *config_override = nullptr);
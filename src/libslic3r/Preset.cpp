@@ -591,6 +591,7 @@ static std::vector<std::string> s_Preset_sla_print_options {
     "hollowing_min_thickness",
     "hollowing_quality",
     "hollowing_closing_distance",
+    "hollowing_max_memory",
     "output_filename_format",
     "default_sla_print_profile",
     "compatible_printers",
@@ -67,6 +67,7 @@ void Print::clear()
 	m_objects.clear();
     m_print_regions.clear();
     m_model.clear_objects();
+    m_volume_slices_cache.clear();
 }
 
 // Called by Print::apply().
@@ -938,6 +939,8 @@ void Print::process()
 
     BOOST_LOG_TRIVIAL(info) << "Starting the slicing process." << log_memory_info();
 
+    this->prune_volume_slices_cache();
+
     tbb::parallel_for(tbb::blocked_range<size_t>(0, m_objects.size(), 1), [this](const tbb::blocked_range<size_t> &range) {
         for (size_t idx = range.begin(); idx < range.end(); ++idx) {
             m_objects[idx]->make_perimeters();
@@ -1026,6 +1029,71 @@ void Print::process()
     BOOST_LOG_TRIVIAL(info) << "Slicing process finished." << log_memory_info();
 }
 
+std::vector<CachedVolumeSlices> Print::cached_volume_slices(const ModelVolumePtrs &volumes) const
+{
+    std::vector<CachedVolumeSlices> out;
+    std::scoped_lock<std::mutex> lock(m_volume_slices_cache_mutex);
+    if (! m_volume_slices_cache.empty()) {
+        for (const ModelVolume *volume : volumes)
+            for (auto it = lower_bound_by_predicate(m_volume_slices_cache.begin(), m_volume_slices_cache.end(),
+                    [volume](const CachedVolumeSlices &cached) { return cached.volume_id < volume->id(); });
+                 it != m_volume_slices_cache.end() && it->volume_id == volume->id(); ++ it)
+                out.emplace_back(*it);
+        // Keep the slicings of a single ModelVolume sorted from the most recently used.
+        std::stable_sort(out.begin(), out.end(), [](const CachedVolumeSlices &l, const CachedVolumeSlices &r) { return l.volume_id < r.volume_id; });
+    }
+    return out;
+}
+
+// volume_slices are the slicings used by a single PrintObject::slice_volumes() call, one per ModelVolume, sorted by ModelVolume ID.
+void Print::retain_volume_slices(std::vector<CachedVolumeSlices> &&volume_slices)
+{
+    // The current slicing and the previous ones retained for each ModelVolume.
+    static constexpr size_t max_cached_slicings = 3;
+
+    std::scoped_lock<std::mutex> lock(m_volume_slices_cache_mutex);
+    std::vector<CachedVolumeSlices> out;
+    out.reserve(m_volume_slices_cache.size() + volume_slices.size());
+    auto it_old = m_volume_slices_cache.begin();
+    for (CachedVolumeSlices &used : volume_slices) {
+        // Slicings of ModelVolumes not sliced by this call.
+        for (; it_old != m_volume_slices_cache.end() && it_old->volume_id < used.volume_id; ++ it_old)
+            out.emplace_back(std::move(*it_old));
+        const ObjectID volume_id = used.volume_id;
+        const auto     mesh      = used.mesh;
+        const auto     slices    = used.slices;
+        out.emplace_back(std::move(used));
+        // Retain the previous slicings of the same mesh, possibly of another PrintObject of the same ModelObject.
+        // Slicings of a replaced mesh would never be hit again.
+        size_t num_cached = 1;
+        for (; it_old != m_volume_slices_cache.end() && it_old->volume_id == volume_id; ++ it_old)
+            if (num_cached < max_cached_slicings && it_old->mesh == mesh && it_old->slices != slices) {
+                out.emplace_back(std::move(*it_old));
+                ++ num_cached;
+            }
+    }
+    for (; it_old != m_volume_slices_cache.end(); ++ it_old)
+        out.emplace_back(std::move(*it_old));
+    m_volume_slices_cache = std::move(out);
+}
+
+void Print::prune_volume_slices_cache()
+{
+    std::scoped_lock<std::mutex> lock(m_volume_slices_cache_mutex);
+    if (m_volume_slices_cache.empty())
+        return;
+    std::vector<std::pair<ObjectID, const TriangleMesh*>> volumes;
+    for (const ModelObject *model_object : m_model.objects)
+        for (const ModelVolume *model_volume : model_object->volumes)
+            volumes.emplace_back(model_volume->id(), model_volume->get_mesh_shared_ptr().get());
+    std::sort(volumes.begin(), volumes.end());
+    m_volume_slices_cache.erase(std::remove_if(m_volume_slices_cache.begin(), m_volume_slices_cache.end(),
+        [&volumes](const CachedVolumeSlices &cached) {
+            auto it = lower_bound_by_predicate(volumes.begin(), volumes.end(), [&cached](const auto &v) { return v.first < cached.volume_id; });
+            return it == volumes.end() || it->first != cached.volume_id || it->second != cached.mesh.get();
+        }), m_volume_slices_cache.end());
+}
+
 // G-code export process, running at a background thread.
 // The export_gcode may die for various reasons (fails to process output_filename_format,
 // write error into the G-code, cannot execute post-processing scripts).
@@ -1045,6 +1113,13 @@ std::string Print::export_gcode(const std::string& path_template, GCodeProcessor
         message = _u8L("Generating G-code");
     this->set_status(90, message);
 
+    if (m_release_layers_after_export)
+        for (PrintObject *object : m_objects) {
+            // Only needed to generate the infill.
+            object->m_adaptive_fill_octrees = {};
+            object->m_lightning_generator.reset();
+        }
+
     // Create GCode on heap, it has quite a lot of data.
     std::unique_ptr<GCodeGenerator> gcode(new GCodeGenerator);
     gcode->do_export(this, path.c_str(), result, thumbnail_cb);
@@ -30,6 +30,7 @@
 #include "Flow.hpp"
 #include "Point.hpp"
 #include "Slicing.hpp"
+#include "SlicesDiskCache.hpp"
 #include "SupportSpotsGenerator.hpp"
 #include "TriangleMeshSlicer.hpp"
 #include "GCode/ToolOrdering.hpp"
@@ -255,6 +256,19 @@ private:
     size_t                                      m_ref_cnt{ 0 };
 };
 
+// Slices of a single ModelVolume retained by an interactive Print to be reused by PrintObject::slice_volumes()
+// if the same ModelVolume is sliced again with the same mesh, transformation, slicing parameters and layer Zs.
+struct CachedVolumeSlices
+{
+    ObjectID                             volume_id;
+    // Holding the mesh, so that its address could not be reused by another mesh.
+    std::shared_ptr<const TriangleMesh>  mesh;
+    MeshSlicingParamsEx                  params;
+    std::vector<float>                   zs;
+    // Shared by the successive caches, a retained slicing is not copied.
+    std::shared_ptr<const std::vector<ExPolygons>> slices;
+};
+
 class PrintObject : public PrintObjectBaseWithState<Print, PrintObjectStep, posCount>
 {
 private: // Prevents erroneous use by other classes.
@@ -334,6 +348,10 @@ public:
     //FIXME returing all possible regions before slicing, thus some of the regions may not be slicing at the end.
     std::vector<std::reference_wrapper<const PrintRegion>> all_regions() const;
     const PrintObjectRegions*   shared_regions() const throw() { return m_shared_regions; }
+    // Number of ModelVolumes, whose slices were reused by the last slicing from the slices retained by an interactive Print.
+    size_t                      num_reused_volume_slices() const { return m_num_reused_volume_slices; }
+    // Number of ModelVolumes, whose slices were loaded by the last slicing from the slices disk cache, see Print::set_slices_cache_dir().
+    size_t                      num_loaded_volume_slices() const { return m_num_loaded_volume_slices; }
 
     bool                        has_support()           const { return m_config.support_material || m_config.support_material_enforce_layers > 0; }
     bool                        has_raft()              const { return m_config.raft_layers > 0; }
@@ -435,6 +453,10 @@ private:
     // so that next call to make_perimeters() performs a union() before computing loops
     bool                    				m_typed_slices = false;
 
+    // See num_reused_volume_slices(), num_loaded_volume_slices().
+    size_t                                  m_num_reused_volume_slices { 0 };
+    size_t                                  m_num_loaded_volume_slices { 0 };
+
     std::pair<FillAdaptive::OctreePtr, FillAdaptive::OctreePtr> m_adaptive_fill_octrees;
     FillLightning::GeneratorPtr m_lightning_generator;
 };
@@ -585,6 +607,16 @@ public:
     // Exports G-code into a file name based on the path_template, returns the file path of the generated G-code file.
     // If preview_data is not null, the preview_data is filled in for the G-code visualization (not used by the command line Slic3r).
     std::string         export_gcode(const std::string& path_template, GCodeProcessorResult* result, ThumbnailsGeneratorCallback thumbnail_cb = nullptr);
+    // Let export_gcode() release the data needed to generate the extrusions only, and the extrusions of each layer
+    // as soon as its G-code is generated. Bounds the peak memory of the command line slicer, which discards the Print
+    // after the export. The Print cannot be exported again.
+    void                set_release_layers_after_export(bool release) { m_release_layers_after_export = release; }
+    bool                release_layers_after_export() const { return m_release_layers_after_export; }
+    // Look up the slices of ModelVolumes in a directory shared with the previous sessions and command line runs
+    // before slicing the meshes, store the newly sliced ones there. An empty path disables the disk cache.
+    void                set_slices_cache_dir(const std::string &dir)
+        { m_slices_disk_cache = dir.empty() ? std::nullopt : std::make_optional<SlicesDiskCache>(dir); }
+    const SlicesDiskCache* slices_disk_cache() const { return m_slices_disk_cache ? &*m_slices_disk_cache : nullptr; }
 
     // methods for handling state
     bool                is_step_done(PrintStep step) const { return Inherited::is_step_done(step); }
@@ -686,6 +718,13 @@ private:
     // Unguarded variant, thus it shall only be called from main thread with background processing stopped.
     static bool         is_shared_print_object_step_valid_unguarded(SpanOfConstPtrs<PrintObject> print_objects, PrintObjectStep print_object_step);
 
+    // Slicings of the volumes retained by an interactive Print, see m_volume_slices_cache.
+    // Called by PrintObject::slice_volumes(), possibly from multiple threads.
+    std::vector<CachedVolumeSlices> cached_volume_slices(const ModelVolumePtrs &volumes) const;
+    void                retain_volume_slices(std::vector<CachedVolumeSlices> &&volume_slices);
+    // Drop the slicings of ModelVolumes no more present in m_model.
+    void                prune_volume_slices_cache();
+
     PrintConfig                             m_config;
     PrintObjectConfig                       m_default_object_config;
     PrintRegionConfig                       m_default_region_config;
@@ -713,6 +752,18 @@ private:
     // Cache to store sequential print clearance contours
     Polygons m_sequential_print_clearance_contours;
 
+    // See set_release_layers_after_export().
+    bool                                    m_release_layers_after_export { false };
+    // See set_slices_cache_dir().
+    std::optional<SlicesDiskCache>          m_slices_disk_cache;
+    // Slices of ModelVolumes produced by the last few PrintObject::slice_volumes() calls, sorted by ModelVolume ID
+    // and then from the most recently used. Only retained by an interactive Print, see PrintBase::set_interactive().
+    // Adding or moving a modifier or painting a ModelVolume recreates the PrintObjects, thus the slices are held by the Print,
+    // and only the ModelVolumes with a modified mesh, transformation or slicing parameters are sliced again.
+    // Reverting a change of the layer height or of the slicing parameters reuses the slices of the previous slicing.
+    std::vector<CachedVolumeSlices>         m_volume_slices_cache;
+    mutable std::mutex                      m_volume_slices_cache_mutex;
+
     // To allow GCode to set the Print's GCodeExport step status.
     friend class GCodeGenerator;
     // To allow GCodeProcessor to emit warnings.
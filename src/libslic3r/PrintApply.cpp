@@ -209,7 +209,7 @@ static t_config_option_keys print_config_diffs(
     const std::vector<std::string> &extruder_retract_keys = print_config_def.extruder_retract_keys();
     const std::string               filament_prefix       = "filament_";
     t_config_option_keys            print_diff;
-    for (const t_config_option_key &opt_key : current_config.keys()) {
+    for (const t_config_option_key &opt_key : current_config.keys_ref()) {
         const ConfigOption *opt_old = current_config.option(opt_key);
         assert(opt_old != nullptr);
         const ConfigOption *opt_new = new_full_config.option(opt_key);
@@ -244,11 +244,13 @@ static t_config_option_keys print_config_diffs(
 static t_config_option_keys full_print_config_diffs(const DynamicPrintConfig &current_full_config, const DynamicPrintConfig &new_full_config)
 {
     t_config_option_keys full_config_diff;
-    for (const t_config_option_key &opt_key : new_full_config.keys()) {
-        const ConfigOption *opt_old = current_full_config.option(opt_key);
-        const ConfigOption *opt_new = new_full_config.option(opt_key);
-        if (opt_old == nullptr || *opt_new != *opt_old)
-            full_config_diff.emplace_back(opt_key);
+    // Both configs are sorted by the option keys, merge them in linear time.
+    auto it_old = current_full_config.cbegin();
+    for (auto it_new = new_full_config.cbegin(); it_new != new_full_config.cend(); ++ it_new) {
+        while (it_old != current_full_config.cend() && it_old->first < it_new->first)
+            ++ it_old;
+        if (it_old == current_full_config.cend() || it_old->first != it_new->first || *it_new->second != *it_old->second)
+            full_config_diff.emplace_back(it_new->first);
     }
     return full_config_diff;
 }
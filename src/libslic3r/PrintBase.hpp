@@ -526,6 +526,12 @@ public:
     const PlaceholderParser&   placeholder_parser() const { return m_placeholder_parser; }
     const DynamicPrintConfig&  full_print_config() const { return m_full_print_config; }
 
+    // The Print is driven by the user interface: Its results are displayed and it is processed again after each edit.
+    // Data for the visualization only is produced by the background processing and caches speeding up
+    // the repeated processing are maintained. Not set by the command line slicer.
+    void                       set_interactive(bool interactive) { m_interactive = interactive; }
+    bool                       interactive() const { return m_interactive; }
+
     virtual std::string        output_filename(const std::string &filename_base = std::string()) const = 0;
     // If the filename_base is set, it is used as the input for the template processing. In that case the path is expected to be the directory (may be empty).
     // If filename_set is empty, than the path may be a file or directory. If it is a file, then the macro will not be processed.
@@ -561,6 +567,9 @@ protected:
     // Callback to be evoked regularly to update state of the UI thread.
     status_callback_type                    m_status_callback;
 
+    // See set_interactive().
+    bool                                    m_interactive { false };
+
 private:
     std::atomic<CancelStatus>               m_cancel_status;
 
@@ -4437,6 +4437,17 @@ void PrintConfigDef::init_sla_params()
     def->mode = comExpert;
     def->set_default_value(new ConfigOptionFloat(2.0));
 
+    def = this->add("hollowing_max_memory", coFloat);
+    def->label = L("Memory limit");
+    def->category = L("Hollowing");
+    def->tooltip  = L("Upper limit of the memory used to calculate the interior of a hollowed model. "
+                      "The accuracy is lowered if the object would not fit into the limit. "
+                      "Set zero for no limit.");
+    def->sidetext = L("MB");
+    def->min = 0;
+    def->mode = comExpert;
+    def->set_default_value(new ConfigOptionFloat(0.));
+
     def = this->add("material_print_speed", coEnum);
     def->label = L("Print speed");
     def->tooltip = L(
@@ -5216,6 +5227,16 @@ CLIMiscConfigDef::CLIMiscConfigDef()
     def->tooltip = L("The file where the output will be written (if not specified, it will be based on the input file).");
     def->cli = "output|o";
 
+    def = this->add("release_exported_layers", coBool);
+    def->label = L("Release exported layers");
+    def->tooltip = L("Release the toolpaths of each layer as soon as its G-code is exported to bound the memory consumption "
+                     "of very large prints. Applies to the G-code export only.");
+
+    def = this->add("slices_cache", coString);
+    def->label = L("Slices cache directory");
+    def->tooltip = L("Directory to store the slices of the objects in and to load them from when the same object "
+                     "is sliced again with the same settings, possibly by another run of PrusaSlicer.");
+
     def = this->add("single_instance", coBool);
     def->label = L("Single instance mode");
     def->tooltip = L("If enabled, the command line arguments are sent to an existing instance of GUI PrusaSlicer, "
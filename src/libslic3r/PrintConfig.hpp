@@ -369,9 +369,50 @@ protected:
             return (it == m_map_name_to_offset.end()) ? nullptr : reinterpret_cast<const ConfigOption*>((const char*)owner + it->second);
         }
 
+        // Option of the owner by the index of its key in keys(). The index is an interned option key:
+        // It is stable for the life time of the application and it is resolved without any string comparison.
+        const ConfigOption* optptr(size_t idx, const T *owner) const
+        {
+            assert(idx < m_offsets.size());
+            return reinterpret_cast<const ConfigOption*>((const char*)owner + m_offsets[idx]);
+        }
+
         const std::vector<std::string>& keys()      const { return m_keys; }
         const T&                        defaults()  const { return *m_defaults; }
 
+        // Returns options differing in the two configs.
+        // The options are accessed through the cached offsets, not through the option keys.
+        t_config_option_keys diff(const T *lhs, const T *rhs) const
+        {
+            t_config_option_keys diff;
+            for (size_t i = 0; i < m_offsets.size(); ++ i)
+                if (*this->optptr(i, lhs) != *this->optptr(i, rhs))
+                    diff.emplace_back(m_keys[i]);
+            return diff;
+        }
+
+        // Returns options differing in the two configs, ignoring options not present in rhs.
+        // Both m_keys and the DynamicConfig are sorted by the option key, thus they are merged in linear time
+        // without looking up the keys, similar to DynamicConfig::diff().
+        t_config_option_keys diff(const T *lhs, const DynamicConfig &rhs) const
+        {
+            t_config_option_keys diff;
+            auto j = rhs.cbegin();
+            for (size_t i = 0; i < m_keys.size() && j != rhs.cend();) {
+                if (int cmp = m_keys[i].compare(j->first); cmp < 0)
+                    ++ i;
+                else if (cmp > 0)
+                    ++ j;
+                else {
+                    if (*this->optptr(i, lhs) != *j->second)
+                        diff.emplace_back(m_keys[i]);
+                    ++ i;
+                    ++ j;
+                }
+            }
+            return diff;
+        }
+
         // To be called during the StaticCache setup.
         // Collect option keys from m_map_name_to_offset,
         // assign default values to m_defaults.
@@ -381,6 +422,8 @@ protected:
             m_defaults = defaults;
             m_keys.clear();
             m_keys.reserve(m_map_name_to_offset.size());
+            m_offsets.clear();
+            m_offsets.reserve(m_map_name_to_offset.size());
             for (const auto &kvp : defs->options) {
                 // Find the option given the option name kvp.first by an offset from (char*)m_defaults.
                 ConfigOption *opt = this->optptr(kvp.first, m_defaults);
@@ -388,6 +431,7 @@ protected:
                     // This option is not defined by the ConfigBase of type T.
                     continue;
                 m_keys.emplace_back(kvp.first);
+                m_offsets.emplace_back(m_map_name_to_offset[kvp.first]);
                 const ConfigOptionDef *def = defs->get(kvp.first);
                 assert(def != nullptr);
                 if (def->default_value)
@@ -397,7 +441,10 @@ protected:
 
     private:
         T                                  *m_defaults;
+        // Sorted, as ConfigDef::options is sorted.
         std::vector<std::string>            m_keys;
+        // Offsets of the options from the start of T, matching m_keys.
+        std::vector<ptrdiff_t>              m_offsets;
     };
 };
 
@@ -413,6 +460,11 @@ public: \
     t_config_option_keys     keys() const override { return s_cache_##CLASS_NAME.keys(); } \
     const t_config_option_keys& keys_ref() const override { return s_cache_##CLASS_NAME.keys(); } \
     static const CLASS_NAME& defaults() { assert(s_cache_##CLASS_NAME.initialized()); return s_cache_##CLASS_NAME.defaults(); } \
+    /* Overloads ConfigBase::diff(). Options are accessed by their cached offsets, no option key is looked up. */ \
+    t_config_option_keys     diff(const CLASS_NAME &rhs) const { return s_cache_##CLASS_NAME.diff(this, &rhs); } \
+    /* Overloads ConfigBase::diff(). Merges the sorted option keys with the sorted DynamicConfig. */ \
+    t_config_option_keys     diff(const DynamicConfig &rhs) const { return s_cache_##CLASS_NAME.diff(this, rhs); } \
+    using ConfigBase::diff; \
 private: \
     friend int print_config_static_initializer(); \
     static void initialize_cache() \
@@ -1123,6 +1175,10 @@ PRINT_CONFIG_CLASS_DEFINE(
 
     // Indirectly controls the minimum size of created cavities.
     ((ConfigOptionFloat, hollowing_closing_distance))
+
+    // Upper limit of the hollowing voxel grid memory in MB, lowers the
+    // accuracy if needed. Zero means no limit.
+    ((ConfigOptionFloat, hollowing_max_memory))
 )
 
 enum SLAMaterialSpeed { slamsSlow, slamsFast, slamsHighViscosity };
@@ -38,6 +38,7 @@
 #include "Utils.hpp"
 #include "Fill/FillAdaptive.hpp"
 #include "Fill/FillLightning.hpp"
+#include "Fill/FillPlanePath.hpp"
 #include "Format/STL.hpp"
 #include "Support/SupportMaterial.hpp"
 #include "SupportSpotsGenerator.hpp"
@@ -291,10 +292,15 @@ void PrintObject::prepare_infill()
         // The preceding step (perimeter generator) only modifies extra_perimeters and the extra perimeters are only used by discover_vertical_shells()
         // with more than a single region. If this step does not use Surface::extra_perimeters or Surface::extra_perimeters is always zero, it is safe
         // to reset to the untyped slices before re-runnning detect_surfaces_type().
-        for (Layer* layer : m_layers) {
-            layer->restore_untyped_slices_no_extra_perimeters();
-            m_print->throw_if_canceled();
-        }
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, m_layers.size()),
+            [this](const tbb::blocked_range<size_t> &range) {
+                for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+                    m_print->throw_if_canceled();
+                    m_layers[layer_idx]->restore_untyped_slices_no_extra_perimeters();
+                }
+            });
+        m_print->throw_if_canceled();
     }
 
     // This will assign a type (top/bottom/internal) to $layerm->slices.
@@ -308,11 +314,16 @@ void PrintObject::prepare_infill()
     // Here the stTop / stBottomBridge / stBottom infill is turned to just stInternal if zero top / bottom infill layers are configured.
     // Also tiny stInternal surfaces are turned to stInternalSolid.
     BOOST_LOG_TRIVIAL(info) << "Preparing fill surfaces..." << log_memory_info();
-    for (auto *layer : m_layers)
-        for (auto *region : layer->m_regions) {
-            region->prepare_fill_surfaces();
-            m_print->throw_if_canceled();
-        }
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, m_layers.size()),
+        [this](const tbb::blocked_range<size_t> &range) {
+            for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
+                m_print->throw_if_canceled();
+                for (LayerRegion *region : m_layers[layer_idx]->m_regions)
+                    region->prepare_fill_surfaces();
+            }
+        });
+    m_print->throw_if_canceled();
 
 
     // Add solid fills to ensure the shell vertical thickness.
@@ -433,15 +444,17 @@ void PrintObject::infill()
         m_print->set_status(45, _u8L("Making infill"));
         const auto& adaptive_fill_octree = this->m_adaptive_fill_octrees.first;
         const auto& support_fill_octree = this->m_adaptive_fill_octrees.second;
+        // Sparse plane path infill curves shared by the layers, released once the infill is generated.
+        PlanePathCurves plane_path_curves;
 
         BOOST_LOG_TRIVIAL(debug) << "Filling layers in parallel - start";
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, m_layers.size()),
-            [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree](const tbb::blocked_range<size_t>& range) {
+            [this, &adaptive_fill_octree = adaptive_fill_octree, &support_fill_octree = support_fill_octree, &plane_path_curves](const tbb::blocked_range<size_t>& range) {
                 PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
                 for (size_t layer_idx = range.begin(); layer_idx < range.end(); ++ layer_idx) {
                     m_print->throw_if_canceled();
-                    m_layers[layer_idx]->make_fills(adaptive_fill_octree.get(), support_fill_octree.get(), this->m_lightning_generator.get());
+                    m_layers[layer_idx]->make_fills(adaptive_fill_octree.get(), support_fill_octree.get(), this->m_lightning_generator.get(), &plane_path_curves);
                 }
             }
         );
@@ -1290,6 +1303,50 @@ void PrintObject::process_external_surfaces()
     }
 } // void PrintObject::process_external_surfaces()
 
+// Results of an associative and idempotent Clipper operation (union or intersection) over ranges of 2^level consecutive layers.
+// Any range of layers is covered by two possibly overlapping ranges of a power of two length, thus the result
+// over any range is obtained by a single Clipper operation instead of one operation per layer of the range.
+class LayerRangeOperationCache
+{
+public:
+    using Operation = std::function<Polygons(const Polygons&, const Polygons&)>;
+
+    // Input of the operation for each layer. The longest range to be queried limits the number of levels.
+    LayerRangeOperationCache(std::vector<const Polygons*> &&layers, size_t max_range, Operation op, const std::function<void()> &throw_on_cancel) :
+        m_layers(std::move(layers)), m_op(std::move(op))
+    {
+        for (size_t level = 1; (size_t(1) << level) <= max_range && (size_t(1) << level) <= m_layers.size(); ++ level) {
+            const size_t half = size_t(1) << (level - 1);
+            std::vector<Polygons> &out = m_levels.emplace_back(m_layers.size() + 1 - (size_t(2) << (level - 1)));
+            tbb::parallel_for(tbb::blocked_range<size_t>(0, out.size()), [this, level, half, &out, &throw_on_cancel](const tbb::blocked_range<size_t> &range) {
+                for (size_t i = range.begin(); i < range.end(); ++ i) {
+                    throw_on_cancel();
+                    out[i] = m_op(this->range_of_level(level - 1, i), this->range_of_level(level - 1, i + half));
+                }
+            });
+        }
+    }
+
+    // Result of the operation over layers <begin, end).
+    Polygons query(size_t begin, size_t end) const
+    {
+        assert(begin < end && end <= m_layers.size());
+        size_t level = 0;
+        while ((size_t(2) << level) <= end - begin)
+            ++ level;
+        assert(level <= m_levels.size());
+        size_t second = end - (size_t(1) << level);
+        return second == begin ? this->range_of_level(level, begin) : m_op(this->range_of_level(level, begin), this->range_of_level(level, second));
+    }
+
+private:
+    const Polygons& range_of_level(size_t level, size_t begin) const { return level == 0 ? *m_layers[begin] : m_levels[level - 1][begin]; }
+
+    std::vector<const Polygons*>        m_layers;
+    std::vector<std::vector<Polygons>>  m_levels;
+    Operation                           m_op;
+};
+
 void PrintObject::discover_vertical_shells()
 {
     BOOST_LOG_TRIVIAL(info) << "Discovering vertical shells..." << log_memory_info();
@@ -1380,6 +1437,55 @@ void PrintObject::discover_vertical_shells()
         BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells in parallel - end : cache top / bottom";
     }
 
+    // Ranges of layers, from which the top / bottom surfaces are projected to a layer.
+    // Top surfaces are projected from layers <idx_layer + 1, top_range_end), bottom surfaces from layers <bottom_range_begin, idx_layer).
+    auto top_range_end = [this, num_layers](size_t idx_layer, const PrintRegionConfig &region_config) {
+        coordf_t print_z = m_layers[idx_layer]->print_z;
+        size_t   itop    = idx_layer + size_t(region_config.top_solid_layers.value);
+        size_t   i       = idx_layer + 1;
+        while (i < num_layers && (i < itop || m_layers[i]->print_z - print_z < region_config.top_solid_min_thickness - EPSILON))
+            ++ i;
+        return i;
+    };
+    auto bottom_range_begin = [this](size_t idx_layer, const PrintRegionConfig &region_config) {
+        coordf_t bottom_z = m_layers[idx_layer]->bottom_z();
+        int      ibottom  = int(idx_layer) - region_config.bottom_solid_layers.value;
+        int      i        = int(idx_layer) - 1;
+        while (i >= 0 && (i > ibottom || bottom_z - m_layers[i]->bottom_z() < region_config.bottom_solid_min_thickness - EPSILON))
+            -- i;
+        return size_t(i + 1);
+    };
+    // The longest range of layers projected to a single layer limits the depth of the layer range caches.
+    auto max_projected_range = [this, num_layers, &top_range_end, &bottom_range_begin](const PrintRegionConfig &region_config) {
+        size_t max_range = 1;
+        for (size_t idx_layer = 0; idx_layer < num_layers; ++ idx_layer) {
+            if (region_config.top_solid_layers.value > 0)
+                max_range = std::max(max_range, top_range_end(idx_layer, region_config) - idx_layer - 1);
+            if (region_config.bottom_solid_layers.value > 0)
+                max_range = std::max(max_range, idx_layer - bottom_range_begin(idx_layer, region_config));
+        }
+        return max_range;
+    };
+    auto union_op        = [](const Polygons &a, const Polygons &b) { return a.empty() ? b : b.empty() ? a : union_(a, b); };
+    // Holes are cleared once a layer without holes is encountered, see combine_holes() below.
+    auto intersection_op = [](const Polygons &a, const Polygons &b) { return a.empty() || b.empty() ? Polygons() : intersection(a, b); };
+    auto throw_on_cancel = [this]() { m_print->throw_if_canceled(); };
+    auto make_range_cache = [&cache_top_botom_regions, num_layers, &throw_on_cancel](Polygons DiscoverVerticalShellsCacheEntry::*member, size_t max_range, LayerRangeOperationCache::Operation op) {
+        std::vector<const Polygons*> layers;
+        layers.reserve(num_layers);
+        for (const DiscoverVerticalShellsCacheEntry &cache : cache_top_botom_regions)
+            layers.emplace_back(&(cache.*member));
+        return std::make_unique<LayerRangeOperationCache>(std::move(layers), max_range, std::move(op), throw_on_cancel);
+    };
+    size_t max_range_all_regions = 1;
+    for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id)
+        max_range_all_regions = std::max(max_range_all_regions, max_projected_range(this->printing_region(region_id).config()));
+    // Holes are collected over all regions, thus their range cache is shared by all regions.
+    // Top / bottom surfaces are shared by all regions only if top_bottom_surfaces_all_regions.
+    std::unique_ptr<LayerRangeOperationCache> holes_range_cache;
+    std::unique_ptr<LayerRangeOperationCache> top_range_cache;
+    std::unique_ptr<LayerRangeOperationCache> bottom_range_cache;
+
     for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id) {
         //FIXME Improve the heuristics for a grain size.
         size_t grain_size = std::max(num_layers / 16, size_t(1));
@@ -1416,11 +1522,24 @@ void PrintObject::discover_vertical_shells()
             BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - end : cache top / bottom";
         }
 
+        // Unions of top / bottom surfaces and intersections of holes over ranges of layers,
+        // reused by all layers instead of combining the projected layers one by one for each layer.
+        BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - start : cache layer ranges";
+        if (! holes_range_cache)
+            holes_range_cache = make_range_cache(&DiscoverVerticalShellsCacheEntry::holes, max_range_all_regions, intersection_op);
+        if (! top_bottom_surfaces_all_regions || ! top_range_cache) {
+            size_t max_range = top_bottom_surfaces_all_regions ? max_range_all_regions : max_projected_range(this->printing_region(region_id).config());
+            top_range_cache    = make_range_cache(&DiscoverVerticalShellsCacheEntry::top_surfaces, max_range, union_op);
+            bottom_range_cache = make_range_cache(&DiscoverVerticalShellsCacheEntry::bottom_surfaces, max_range, union_op);
+        }
+        m_print->throw_if_canceled();
+        BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - end : cache layer ranges";
+
         BOOST_LOG_TRIVIAL(debug) << "Discovering vertical shells for region " << region_id << " in parallel - start : ensure vertical wall thickness";
         grain_size = 1;
         tbb::parallel_for(
             tbb::blocked_range<size_t>(0, num_layers, grain_size),
-            [this, region_id, &cache_top_botom_regions]
+            [this, region_id, &cache_top_botom_regions, &top_range_end, &bottom_range_begin, &holes_range_cache, &top_range_cache, &bottom_range_cache]
             (const tbb::blocked_range<size_t>& range) {
                 PRINT_OBJECT_TIME_LIMIT_MILLIS(PRINT_OBJECT_TIME_LIMIT_DEFAULT);
                 // printf("discover_vertical_shells from %d to %d\n", range.begin(), range.end());
@@ -1492,17 +1611,13 @@ void PrintObject::discover_vertical_shells()
 			        if (int n_top_layers = region_config.top_solid_layers.value; n_top_layers > 0) {
                         // Gather top regions projected to this layer.
                         coordf_t print_z = layer->print_z;
-                        int i = int(idx_layer) + 1;
+                        int i = int(top_range_end(idx_layer, region_config));
                         int itop = int(idx_layer) + n_top_layers;
-                        bool at_least_one_top_projected = false;
-	                    for (; i < int(cache_top_botom_regions.size()) &&
-	                         (i < itop || m_layers[i]->print_z - print_z < region_config.top_solid_min_thickness - EPSILON);
-	                        ++ i) {
-                            at_least_one_top_projected = true;
-	                        const DiscoverVerticalShellsCacheEntry &cache = cache_top_botom_regions[i];
-                            combine_holes(cache.holes);
-                            combine_shells(cache.top_surfaces);
-	                    }
+                        bool at_least_one_top_projected = i > int(idx_layer) + 1;
+                        if (at_least_one_top_projected) {
+                            combine_holes(holes_range_cache->query(idx_layer + 1, size_t(i)));
+                            combine_shells(top_range_cache->query(idx_layer + 1, size_t(i)));
+                        }
                         if (!at_least_one_top_projected && i < int(cache_top_botom_regions.size())) {
                             // Lets consider this a special case - with only 1 top solid and minimal shell thickness settings, the
                             // boundaries of solid layers are not anchored over/under perimeters, so lets fix it by adding at least one
@@ -1521,17 +1636,13 @@ void PrintObject::discover_vertical_shells()
 	                if (int n_bottom_layers = region_config.bottom_solid_layers.value; n_bottom_layers > 0) {
                         // Gather bottom regions projected to this layer.
                         coordf_t bottom_z = layer->bottom_z();
-                        int i = int(idx_layer) - 1;
+                        int i = int(bottom_range_begin(idx_layer, region_config)) - 1;
                         int ibottom = int(idx_layer) - n_bottom_layers;
-                        bool at_least_one_bottom_projected = false;
-	                    for (; i >= 0 &&
-	                         (i > ibottom || bottom_z - m_layers[i]->bottom_z() < region_config.bottom_solid_min_thickness - EPSILON);
-	                        -- i) {
-                                at_least_one_bottom_projected = true;
-	                        const DiscoverVerticalShellsCacheEntry &cache = cache_top_botom_regions[i];
-							combine_holes(cache.holes);
-                            combine_shells(cache.bottom_surfaces);
-	                    }
+                        bool at_least_one_bottom_projected = i + 1 < int(idx_layer);
+                        if (at_least_one_bottom_projected) {
+                            combine_holes(holes_range_cache->query(size_t(i + 1), idx_layer));
+                            combine_shells(bottom_range_cache->query(size_t(i + 1), idx_layer));
+                        }
 
                         if (!at_least_one_bottom_projected && i >= 0) {
                             Polygons anchor_area = intersection(expand(cache_top_botom_regions[idx_layer].bottom_surfaces,
@@ -2832,24 +2943,30 @@ void PrintObject::discover_horizontal_shells()
 {
     BOOST_LOG_TRIVIAL(trace) << "discover_horizontal_shells()";
 
-    for (size_t region_id = 0; region_id < this->num_printing_regions(); ++region_id) {
-        for (size_t i = 0; i < m_layers.size(); ++i) {
-            m_print->throw_if_canceled();
-            Layer                   *layer         = m_layers[i];
-            LayerRegion             *layerm        = layer->regions()[region_id];
-            const PrintRegionConfig &region_config = layerm->region().config();
-            if (region_config.solid_infill_every_layers.value > 0 && region_config.fill_density.value > 0 &&
-                (i % region_config.solid_infill_every_layers) == 0) {
-                // Insert a solid internal layer. Mark stInternal surfaces as stInternalSolid or stInternalBridge.
-                SurfaceType type = (region_config.fill_density == 100 || region_config.solid_infill_every_layers == 1) ? stInternalSolid :
-                                                                                                                         stInternalBridge;
-                for (Surface &surface : layerm->m_fill_surfaces.surfaces)
-                    if (surface.surface_type == stInternal)
-                        surface.surface_type = type;
-            }
-            // The rest has already been performed by discover_vertical_shells().
-        } // for each layer
-    }     // for each region
+    // Each layer is only modified by itself.
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, m_layers.size()),
+        [this](const tbb::blocked_range<size_t> &range) {
+            for (size_t i = range.begin(); i < range.end(); ++ i) {
+                m_print->throw_if_canceled();
+                Layer *layer = m_layers[i];
+                for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id) {
+                    LayerRegion             *layerm        = layer->regions()[region_id];
+                    const PrintRegionConfig &region_config = layerm->region().config();
+                    if (region_config.solid_infill_every_layers.value > 0 && region_config.fill_density.value > 0 &&
+                        (i % region_config.solid_infill_every_layers) == 0) {
+                        // Insert a solid internal layer. Mark stInternal surfaces as stInternalSolid or stInternalBridge.
+                        SurfaceType type = (region_config.fill_density == 100 || region_config.solid_infill_every_layers == 1) ? stInternalSolid :
+                                                                                                                                 stInternalBridge;
+                        for (Surface &surface : layerm->m_fill_surfaces.surfaces)
+                            if (surface.surface_type == stInternal)
+                                surface.surface_type = type;
+                    }
+                    // The rest has already been performed by discover_vertical_shells().
+                } // for each region
+            } // for each layer
+        });
+    m_print->throw_if_canceled();
 
 #ifdef SLIC3R_DEBUG_SLICE_PROCESSING
     for (size_t region_id = 0; region_id < this->num_printing_regions(); ++region_id) {
@@ -2867,6 +2984,15 @@ void PrintObject::discover_horizontal_shells()
 // fill_surfaces but we only turn them into VOID surfaces, thus preserving the boundaries.
 void PrintObject::combine_infill()
 {
+    // Ranges of layers to be combined: the combined layers are stacked below layer_idx.
+    // The ranges of a region do not overlap and the regions are independent, thus all the ranges are combined in parallel.
+    struct CombinedLayers {
+        size_t region_id;
+        size_t layer_idx;
+        size_t num_layers;
+    };
+    std::vector<CombinedLayers> combined_layers;
+
     // Work on each region separately.
     for (size_t region_id = 0; region_id < this->num_printing_regions(); ++ region_id) {
         const PrintRegion &region = this->printing_region(region_id);
@@ -2905,71 +3031,79 @@ void PrintObject::combine_infill()
             combine[m_layers.size() - 1] = num_layers;
         }
         
-        // loop through layers to which we have assigned layers to combine
-        for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx) {
-            m_print->throw_if_canceled();
-            size_t num_layers = combine[layer_idx];
-			if (num_layers <= 1)
-                continue;
-            // Get all the LayerRegion objects to be combined.
-            std::vector<LayerRegion*> layerms;
-            layerms.reserve(num_layers);
-			for (size_t i = layer_idx + 1 - num_layers; i <= layer_idx; ++ i)
-                layerms.emplace_back(m_layers[i]->regions()[region_id]);
-            // We need to perform a multi-layer intersection, so let's split it in pairs.
-            // Initialize the intersection with the candidates of the lowest layer.
-            ExPolygons intersection = to_expolygons(layerms.front()->fill_surfaces().filter_by_type(stInternal));
-            // Start looping from the second layer and intersect the current intersection with it.
-            for (size_t i = 1; i < layerms.size(); ++ i)
-                intersection = intersection_ex(layerms[i]->fill_surfaces().filter_by_type(stInternal), intersection);
-            double area_threshold = layerms.front()->infill_area_threshold();
-            if (! intersection.empty() && area_threshold > 0.)
-                intersection.erase(std::remove_if(intersection.begin(), intersection.end(), 
-                    [area_threshold](const ExPolygon &expoly) { return expoly.area() <= area_threshold; }), 
-                    intersection.end());
-            if (intersection.empty())
-                continue;
-//            Slic3r::debugf "  combining %d %s regions from layers %d-%d\n",
-//                scalar(@$intersection),
-//                ($type == stInternal ? 'internal' : 'internal-solid'),
-//                $layer_idx-($every-1), $layer_idx;
-            // intersection now contains the regions that can be combined across the full amount of layers,
-            // so let's remove those areas from all layers.
-            Polygons intersection_with_clearance;
-            intersection_with_clearance.reserve(intersection.size());
-            float clearance_offset = 
-                0.5f * layerms.back()->flow(frPerimeter).scaled_width() +
-             // Because fill areas for rectilinear and honeycomb are grown 
-             // later to overlap perimeters, we need to counteract that too.
-                ((region.config().fill_pattern == ipRectilinear   ||
-                  region.config().fill_pattern == ipMonotonic     ||
-                  region.config().fill_pattern == ipGrid          ||
-                  region.config().fill_pattern == ipLine          ||
-                  region.config().fill_pattern == ipHoneycomb) ? 1.5f : 0.5f) * 
-                    layerms.back()->flow(frSolidInfill).scaled_width();
-            for (ExPolygon &expoly : intersection)
-                polygons_append(intersection_with_clearance, offset(expoly, clearance_offset));
-            for (LayerRegion *layerm : layerms) {
-                Polygons internal = to_polygons(std::move(layerm->fill_surfaces().filter_by_type(stInternal)));
-                layerm->m_fill_surfaces.remove_type(stInternal);
-                layerm->m_fill_surfaces.append(diff_ex(internal, intersection_with_clearance), stInternal);
-                if (layerm == layerms.back()) {
-                    // Apply surfaces back with adjusted depth to the uppermost layer.
-                    Surface templ(stInternal, ExPolygon());
-                    templ.thickness = 0.;
-                    for (LayerRegion *layerm2 : layerms)
-                        templ.thickness += layerm2->layer()->height;
-                    templ.thickness_layers = (unsigned short)layerms.size();
-                    layerm->m_fill_surfaces.append(intersection, templ);
-                } else {
-                    // Save void surfaces.
-                    layerm->m_fill_surfaces.append(
-                        intersection_ex(internal, intersection_with_clearance),
-                        stInternalVoid);
+        // collect layers to which we have assigned layers to combine
+        for (size_t layer_idx = 0; layer_idx < m_layers.size(); ++ layer_idx)
+            if (combine[layer_idx] > 1)
+                combined_layers.push_back({ region_id, layer_idx, combine[layer_idx] });
+    }
+
+    tbb::parallel_for(
+        tbb::blocked_range<size_t>(0, combined_layers.size(), 1),
+        [this, &combined_layers](const tbb::blocked_range<size_t> &range) {
+            for (size_t combined_idx = range.begin(); combined_idx < range.end(); ++ combined_idx) {
+                m_print->throw_if_canceled();
+                const auto [region_id, layer_idx, num_layers] = combined_layers[combined_idx];
+                const PrintRegion &region = this->printing_region(region_id);
+                // Get all the LayerRegion objects to be combined.
+                std::vector<LayerRegion*> layerms;
+                layerms.reserve(num_layers);
+                for (size_t i = layer_idx + 1 - num_layers; i <= layer_idx; ++ i)
+                    layerms.emplace_back(m_layers[i]->regions()[region_id]);
+                // We need to perform a multi-layer intersection, so let's split it in pairs.
+                // Initialize the intersection with the candidates of the lowest layer.
+                ExPolygons intersection = to_expolygons(layerms.front()->fill_surfaces().filter_by_type(stInternal));
+                // Start looping from the second layer and intersect the current intersection with it.
+                for (size_t i = 1; i < layerms.size(); ++ i)
+                    intersection = intersection_ex(layerms[i]->fill_surfaces().filter_by_type(stInternal), intersection);
+                double area_threshold = layerms.front()->infill_area_threshold();
+                if (! intersection.empty() && area_threshold > 0.)
+                    intersection.erase(std::remove_if(intersection.begin(), intersection.end(), 
+                        [area_threshold](const ExPolygon &expoly) { return expoly.area() <= area_threshold; }), 
+                        intersection.end());
+                if (intersection.empty())
+                    continue;
+                // Slic3r::debugf "  combining %d %s regions from layers %d-%d\n",
+                //     scalar(@$intersection),
+                //     ($type == stInternal ? 'internal' : 'internal-solid'),
+                //     $layer_idx-($every-1), $layer_idx;
+                // intersection now contains the regions that can be combined across the full amount of layers,
+                // so let's remove those areas from all layers.
+                Polygons intersection_with_clearance;
+                intersection_with_clearance.reserve(intersection.size());
+                float clearance_offset = 
+                    0.5f * layerms.back()->flow(frPerimeter).scaled_width() +
+                    // Because fill areas for rectilinear and honeycomb are grown 
+                    // later to overlap perimeters, we need to counteract that too.
+                    ((region.config().fill_pattern == ipRectilinear   ||
+                      region.config().fill_pattern == ipMonotonic     ||
+                      region.config().fill_pattern == ipGrid          ||
+                      region.config().fill_pattern == ipLine          ||
+                      region.config().fill_pattern == ipHoneycomb) ? 1.5f : 0.5f) * 
+                        layerms.back()->flow(frSolidInfill).scaled_width();
+                for (ExPolygon &expoly : intersection)
+                    polygons_append(intersection_with_clearance, offset(expoly, clearance_offset));
+                for (LayerRegion *layerm : layerms) {
+                    Polygons internal = to_polygons(std::move(layerm->fill_surfaces().filter_by_type(stInternal)));
+                    layerm->m_fill_surfaces.remove_type(stInternal);
+                    layerm->m_fill_surfaces.append(diff_ex(internal, intersection_with_clearance), stInternal);
+                    if (layerm == layerms.back()) {
+                        // Apply surfaces back with adjusted depth to the uppermost layer.
+                        Surface templ(stInternal, ExPolygon());
+                        templ.thickness = 0.;
+                        for (LayerRegion *layerm2 : layerms)
+                            templ.thickness += layerm2->layer()->height;
+                        templ.thickness_layers = (unsigned short)layerms.size();
+                        layerm->m_fill_surfaces.append(intersection, templ);
+                    } else {
+                        // Save void surfaces.
+                        layerm->m_fill_surfaces.append(
+                            intersection_ex(internal, intersection_with_clearance),
+                            stInternalVoid);
+                    }
                 }
             }
-        }
-    }
+        });
+    m_print->throw_if_canceled();
 } // void PrintObject::combine_infill()
 
 void PrintObject::_generate_support_material(bool useSecondarySetting)
@@ -64,6 +64,69 @@ static std::vector<ExPolygons> slice_volume(
     return layers;
 }
 
+static inline bool slicing_params_equal(const MeshSlicingParamsEx &l, const MeshSlicingParamsEx &r)
+{
+    return l.mode == r.mode && l.slicing_mode_normal_below_layer == r.slicing_mode_normal_below_layer && l.mode_below == r.mode_below &&
+           l.trafo.matrix() == r.trafo.matrix() && l.closing_radius == r.closing_radius && l.extra_offset == r.extra_offset &&
+           l.resolution == r.resolution;
+}
+
+// Slices of ModelVolumes retained by the Print from the previous slicings (cache_old) and the slices of this slicing (cache_new),
+// both sorted by ModelVolume ID, the slicings of a single ModelVolume in cache_old sorted from the most recently used.
+// Slices are only retained if retain is set, that is for an interactive Print, which is sliced repeatedly.
+// Slices missing in cache_old are looked up in the optional disk cache shared with other sessions.
+struct VolumeSlicesCache
+{
+    std::vector<CachedVolumeSlices>        cache_old;
+    std::vector<CachedVolumeSlices>        cache_new;
+    const SlicesDiskCache                 *disk_cache { nullptr };
+    bool                                   retain { false };
+    size_t                                 num_reused { 0 };
+    size_t                                 num_loaded { 0 };
+};
+
+// Slice single triangle mesh, reuse the slices of one of the previous slicings if the mesh, its placement and slicing parameters
+// were the same, for example if a change of the layer height or of the slicing mode has been reverted.
+static std::vector<ExPolygons> slice_volume(
+    const ModelVolume             &volume,
+    const std::vector<float>      &zs, 
+    const MeshSlicingParamsEx     &params,
+    VolumeSlicesCache             &cache,
+    const std::function<void()>   &throw_on_cancel_callback)
+{
+    std::vector<ExPolygons> layers;
+    if (! zs.empty()) {
+        MeshSlicingParamsEx params_key { params };
+        params_key.trafo = params_key.trafo * volume.get_matrix();
+        auto it_begin = lower_bound_by_predicate(cache.cache_old.begin(), cache.cache_old.end(),
+            [&volume](const CachedVolumeSlices &cached) { return cached.volume_id < volume.id(); });
+        auto it_end   = std::find_if(it_begin, cache.cache_old.end(),
+            [&volume](const CachedVolumeSlices &cached) { return cached.volume_id != volume.id(); });
+        auto it_cached = std::find_if(it_begin, it_end, [&volume, &zs, &params_key](const CachedVolumeSlices &cached) {
+            return cached.mesh == volume.get_mesh_shared_ptr() && cached.zs == zs && slicing_params_equal(cached.params, params_key);
+        });
+        assert(cache.cache_new.empty() || cache.cache_new.back().volume_id < volume.id());
+        if (it_cached != it_end) {
+            layers = *it_cached->slices;
+            cache.cache_new.push_back(*it_cached);
+            ++ cache.num_reused;
+        } else {
+            std::string disk_key = cache.disk_cache ? SlicesDiskCache::key(volume.mesh().its, params_key, zs) : std::string();
+            if (! disk_key.empty() && cache.disk_cache->load(disk_key, layers) && layers.size() == zs.size())
+                ++ cache.num_loaded;
+            else {
+                layers = slice_volume(volume, zs, params, throw_on_cancel_callback);
+                if (! disk_key.empty())
+                    cache.disk_cache->store(disk_key, layers);
+            }
+            if (cache.retain)
+                cache.cache_new.push_back({ volume.id(), volume.get_mesh_shared_ptr(), params_key, zs,
+                                            std::make_shared<const std::vector<ExPolygons>>(layers) });
+        }
+    }
+    return layers;
+}
+
 // Slice single triangle mesh.
 // Filter the zs not inside the ranges. The ranges are closed at the bottom and open at the top, they are sorted lexicographically and non overlapping.
 static std::vector<ExPolygons> slice_volume(
@@ -71,13 +134,14 @@ static std::vector<ExPolygons> slice_volume(
     const std::vector<float>                    &z,
     const std::vector<t_layer_height_range>     &ranges,
     const MeshSlicingParamsEx                   &params,
+    VolumeSlicesCache                           &cache,
     const std::function<void()>                 &throw_on_cancel_callback)
 {
     std::vector<ExPolygons> out;
     if (! z.empty() && ! ranges.empty()) {
         if (ranges.size() == 1 && z.front() >= ranges.front().first && z.back() < ranges.front().second) {
             // All layers fit into a single range.
-            out = slice_volume(volume, z, params, throw_on_cancel_callback);
+            out = slice_volume(volume, z, params, cache, throw_on_cancel_callback);
         } else {
             std::vector<float>                     z_filtered;
             std::vector<std::pair<size_t, size_t>> n_filtered;
@@ -93,7 +157,7 @@ static std::vector<ExPolygons> slice_volume(
                     n_filtered.emplace_back(std::make_pair(first, i));
             }
             if (! n_filtered.empty()) {
-                std::vector<ExPolygons> layers = slice_volume(volume, z_filtered, params, throw_on_cancel_callback);
+                std::vector<ExPolygons> layers = slice_volume(volume, z_filtered, params, cache, throw_on_cancel_callback);
                 out.assign(z.size(), ExPolygons());
                 i = 0;
                 for (const std::pair<size_t, size_t> &span : n_filtered)
@@ -128,6 +192,7 @@ static std::vector<VolumeSlices> slice_volumes_inner(
     ModelVolumePtrs                                           model_volumes,
     const std::vector<PrintObjectRegions::LayerRangeRegions> &layer_ranges,
     const std::vector<float>                                 &zs,
+    VolumeSlicesCache                                        &cache,
     const std::function<void()>                              &throw_on_cancel_callback)
 {
     model_volumes_sort_by_id(model_volumes);
@@ -177,7 +242,7 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                     }
                     out.push_back({
                         model_volume->id(), 
-                        slice_volume(*model_volume, zs, params, throw_on_cancel_callback)
+                        slice_volume(*model_volume, zs, params, cache, throw_on_cancel_callback)
                     });
                 }
             } else {
@@ -189,7 +254,7 @@ static std::vector<VolumeSlices> slice_volumes_inner(
                 if (! slicing_ranges.empty())
                     out.push_back({ 
                         model_volume->id(), 
-                        slice_volume(*model_volume, zs, slicing_ranges, params, throw_on_cancel_callback)
+                        slice_volume(*model_volume, zs, slicing_ranges, params, cache, throw_on_cancel_callback)
                     });
             }
             if (! out.empty() && out.back().slices.empty())
@@ -700,11 +765,19 @@ void PrintObject::slice_volumes()
     }
 
     std::vector<float>                   slice_zs      = zs_from_layers(m_layers);
-    std::vector<std::vector<ExPolygons>> region_slices = slices_to_regions(this->model_object()->volumes, *m_shared_regions, slice_zs,
-        slice_volumes_inner(
+    // The command line slicer slices once, it does not retain the slices.
+    VolumeSlicesCache                    cache { m_print->cached_volume_slices(this->model_object()->volumes), {}, print->slices_disk_cache(), print->interactive() };
+    std::vector<VolumeSlices>            volume_slices = slice_volumes_inner(
             print->config(), this->config(), this->trafo_centered(),
-            this->model_object()->volumes, m_shared_regions->layer_ranges, slice_zs, throw_on_cancel_callback),
-        throw_on_cancel_callback);
+            this->model_object()->volumes, m_shared_regions->layer_ranges, slice_zs, cache, throw_on_cancel_callback);
+    BOOST_LOG_TRIVIAL(debug) << "Slicing volumes - reused slices of " << cache.num_reused << ", loaded slices of " << cache.num_loaded
+                             << " out of " << volume_slices.size() << " volumes";
+    if (cache.retain)
+        m_print->retain_volume_slices(std::move(cache.cache_new));
+    m_num_reused_volume_slices = cache.num_reused;
+    m_num_loaded_volume_slices = cache.num_loaded;
+    std::vector<std::vector<ExPolygons>> region_slices = slices_to_regions(this->model_object()->volumes, *m_shared_regions, slice_zs,
+        std::move(volume_slices), throw_on_cancel_callback);
 
     for (size_t region_id = 0; region_id < region_slices.size(); ++ region_id) {
         std::vector<ExPolygons> &by_layer = region_slices[region_id];
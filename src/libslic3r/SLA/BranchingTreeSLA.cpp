@@ -9,6 +9,7 @@
 #include "libslic3r/KDTreeIndirect.hpp"
 
 #include "SupportTreeUtils.hpp"
+#include "PinheadCache.hpp"
 #include "BranchingTree/PointCloud.hpp"
 
 #include "Pad.hpp"
@@ -366,11 +367,18 @@ void create_branching_tree(SupportTreeBuilder &builder, const SupportableMesh &s
     std::vector<std::optional<Head>> heads(nondup_idx.size());
     auto leafs = reserve_vector<branchingtree::Node>(nondup_idx.size());
 
+    // Pinheads placed by the previous builds are reused, only the new or
+    // moved support points are placed.
+    std::vector<char> placed(nondup_idx.size(), false);
     execution::for_each(
         ex_tbb, size_t(0), nondup_idx.size(),
-        [&sm, &heads, &nondup_idx, &builder](size_t i) {
-            if (!builder.ctl().stopcondition())
-                heads[i] = calculate_pinhead_placement(ex_seq, sm, nondup_idx[i]);
+        [&sm, &heads, &placed, &nondup_idx, &builder](size_t i) {
+            if (sm.pinhead_cache && sm.pinhead_cache->find(sm.pts[nondup_idx[i]], heads[i]))
+                return;
+            if (!builder.ctl().stopcondition()) {
+                heads[i]  = calculate_pinhead_placement(ex_seq, sm, nondup_idx[i]);
+                placed[i] = true;
+            }
         },
         execution::max_concurrency(ex_tbb)
     );
@@ -378,6 +386,11 @@ void create_branching_tree(SupportTreeBuilder &builder, const SupportableMesh &s
     if (builder.ctl().stopcondition())
         return;
 
+    if (sm.pinhead_cache)
+        for (size_t i = 0; i < nondup_idx.size(); ++i)
+            if (placed[i])
+                sm.pinhead_cache->insert(sm.pts[nondup_idx[i]], heads[i]);
+
     for (auto &h : heads)
         if (h && h->is_valid()) {
             leafs.emplace_back(h->junction_point().cast<float>(), h->r_back_mm);
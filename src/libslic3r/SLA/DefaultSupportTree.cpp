@@ -6,6 +6,7 @@
 
 #include <libslic3r/Optimize/NLoptOptimizer.hpp>
 #include <libslic3r/SLA/Clustering.hpp>
+#include <libslic3r/SLA/PinheadCache.hpp>
 #include <libslic3r/MeshNormals.hpp>
 #include <libslic3r/Execution/ExecutionTBB.hpp>
 
@@ -381,11 +382,6 @@ void DefaultSupportTree::add_pinheads()
         filtered_indices.emplace_back(a.front());
     }
 
-    // calculate the normals to the triangles for filtered points
-    auto nmls = normals(suptree_ex_policy, m_points, m_sm.emesh,
-                        m_sm.cfg.head_front_radius_mm, m_thr,
-                        filtered_indices);
-
     // Not all of the support points have to be a valid position for
     // support creation. The angle may be inappropriate or there may
     // not be enough space for the pinhead. Filtering is applied for
@@ -404,6 +400,30 @@ void DefaultSupportTree::add_pinheads()
             );
     }
 
+    // Take the pinheads placed by the previous builds, only the new or
+    // moved support points are placed below.
+    if (m_sm.pinhead_cache) {
+        PtIndices to_place;
+        to_place.reserve(filtered_indices.size());
+        for (unsigned fidx : filtered_indices) {
+            std::optional<Head> placement;
+            if (! m_sm.pinhead_cache->find(m_sm.pts[fidx], placement))
+                to_place.emplace_back(fidx);
+            else if (placement) {
+                heads[fidx]    = *placement;
+                heads[fidx].id = long(fidx);
+            }
+        }
+        BOOST_LOG_TRIVIAL(debug) << "Reusing " << filtered_indices.size() - to_place.size()
+                                 << " of " << filtered_indices.size() << " pinhead placements";
+        filtered_indices = std::move(to_place);
+    }
+
+    // calculate the normals to the triangles for filtered points
+    auto nmls = normals(suptree_ex_policy, m_points, m_sm.emesh,
+                        m_sm.cfg.head_front_radius_mm, m_thr,
+                        filtered_indices);
+
     std::function<void(unsigned, size_t, double)> filterfn;
     filterfn = [this, &nmls, &heads, &filterfn](unsigned fidx, size_t i, double back_r) {
         m_thr();
@@ -498,6 +518,12 @@ void DefaultSupportTree::add_pinheads()
         },
         execution::max_concurrency(suptree_ex_policy));
 
+    if (m_sm.pinhead_cache)
+        for (unsigned fidx : filtered_indices)
+            m_sm.pinhead_cache->insert(m_sm.pts[fidx], heads[fidx].is_valid() ?
+                                                           std::optional<Head>{ heads[fidx] } :
+                                                           std::optional<Head>{});
+
     for (size_t i = 0; i < heads.size(); ++i)
         if (heads[i].is_valid()) {
             m_builder.add_head(i, heads[i]);
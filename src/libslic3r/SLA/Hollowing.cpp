@@ -38,6 +38,8 @@ struct Interior {
     double thickness = 0.;
     double full_narrowb = 2.;
 
+    size_t peak_memory = 0; // bytes
+
     void reset_accessor() const  // This resets the accessor and its cache
     // Not a thread safe call!
     {
@@ -71,6 +73,11 @@ VoxelGrid &get_grid(Interior &interior)
     return *interior.gridptr;
 }
 
+size_t get_peak_memory(const Interior &interior)
+{
+    return interior.peak_memory;
+}
+
 InteriorPtr generate_interior(const VoxelGrid       &vgrid,
                               const HollowingConfig &hc,
                               const JobController   &ctl)
@@ -82,19 +89,31 @@ InteriorPtr generate_interior(const VoxelGrid       &vgrid,
     float  out_range = 1.f / voxsc; // world units
     auto   narrowb  = 1.f;  // voxel units (voxel count)
 
+    // The input grid is kept by the caller, each step allocates a new grid
+    // while the previous one is still alive.
+    const size_t input_memory = grid_memory_usage(vgrid);
+    size_t peak_memory = input_memory;
+    auto next_grid = [&peak_memory, input_memory](VoxelGridPtr &prev, VoxelGridPtr &&next) {
+        if (next)
+            peak_memory = std::max(peak_memory, input_memory + grid_memory_usage(*next) +
+                                                    (prev ? grid_memory_usage(*prev) : 0));
+        prev = std::move(next);
+    };
+
     if (ctl.stopcondition()) return {};
     else ctl.statuscb(0, _u8L("Hollowing"));
 
-    auto gridptr = dilate_grid(vgrid, out_range, in_range);
+    VoxelGridPtr gridptr;
+    next_grid(gridptr, dilate_grid(vgrid, out_range, in_range));
 
     if (ctl.stopcondition()) return {};
     else ctl.statuscb(30, _u8L("Hollowing"));
 
     double iso_surface = D;
     if (D > EPSILON) {
-        gridptr = redistance_grid(*gridptr, -(offset + D), narrowb, narrowb);
+        next_grid(gridptr, redistance_grid(*gridptr, -(offset + D), narrowb, narrowb));
 
-        gridptr = dilate_grid(*gridptr, 1.1 * std::ceil(iso_surface), 0.f);
+        next_grid(gridptr, dilate_grid(*gridptr, 1.1 * std::ceil(iso_surface), 0.f));
 
         out_range = iso_surface;
         in_range  = narrowb / voxsc;
@@ -117,6 +136,9 @@ InteriorPtr generate_interior(const VoxelGrid       &vgrid,
     interior->iso_surface = iso_surface;
     interior->thickness   = offset;
     interior->full_narrowb = (out_range + in_range) / 2.;
+    interior->peak_memory = peak_memory;
+
+    BOOST_LOG_TRIVIAL(info) << "Hollowing: peak grid memory " << peak_memory / (1024 * 1024) << " MB, voxel scale " << voxsc;
 
     return interior;
 }
@@ -745,9 +767,16 @@ DrainHoles transformed_drainhole_points(const ModelObject &mo,
     return pts;
 }
 
-double get_voxel_scale(double mesh_volume, const HollowingConfig &hc)
+// Voxel scale with the minimum number of samples across the wall.
+static double min_voxel_scale(const HollowingConfig &hc)
 {
     static constexpr double MIN_SAMPLES_IN_WALL = 3.5;
+
+    return std::max(MIN_SAMPLES_IN_WALL / hc.min_thickness, 1.);
+}
+
+double get_voxel_scale(double mesh_volume, const HollowingConfig &hc)
+{
     static constexpr double MAX_OVERSAMPL = 8.;
     static constexpr double UNIT_VOLUME   = 500000; // empiric
 
@@ -764,7 +793,7 @@ double get_voxel_scale(double mesh_volume, const HollowingConfig &hc)
     // the maximum is lowered if the model volume very big.
 
     double sc_divider    = std::max(1.0, (mesh_volume / UNIT_VOLUME));
-    double min_oversampl = std::max(MIN_SAMPLES_IN_WALL / hc.min_thickness, 1.);
+    double min_oversampl = min_voxel_scale(hc);
     double max_oversampl_scaled = std::max(min_oversampl, MAX_OVERSAMPL / sc_divider);
     auto   voxel_scale          = min_oversampl + (max_oversampl_scaled - min_oversampl) * hc.quality;
 
@@ -775,6 +804,61 @@ double get_voxel_scale(double mesh_volume, const HollowingConfig &hc)
     return voxel_scale;
 }
 
+double estimate_hollowing_memory(double mesh_area, double voxel_scale, const HollowingConfig &hc)
+{
+    // The grids are sparse and hold only a narrow band of voxels around the
+    // surface, but the leaf nodes store dense blocks of 8^3 values. A band
+    // 'band' voxels thick covers about area / 8^2 leaves along the surface and
+    // band / 8 + 1 leaves across it.
+    static constexpr double LEAF_DIM   = 8.;
+    static constexpr double LEAF_BYTES = LEAF_DIM * LEAF_DIM * LEAF_DIM * sizeof(float) + 3 * 64; // values and masks
+
+    auto band_memory = [&](double band) {
+        double leaves_along = mesh_area * voxel_scale * voxel_scale / (LEAF_DIM * LEAF_DIM);
+        return LEAF_BYTES * leaves_along * (band / LEAF_DIM + 1.);
+    };
+
+    // The peak is at the first dilation of generate_interior(): the input
+    // grid (3 voxels to each side) is alive with the grid dilated inwards
+    // by the wall thickness and the closing distance.
+    double input_band   = 6.;
+    double dilated_band = 1. + 1.1 * (hc.min_thickness + hc.closing_distance) * voxel_scale;
+
+    return band_memory(input_band) + band_memory(dilated_band);
+}
+
+double get_voxel_scale(double mesh_volume, double mesh_area, const HollowingConfig &hc)
+{
+    double voxel_scale = get_voxel_scale(mesh_volume, hc);
+    if (hc.max_memory_mb <= 0.)
+        return voxel_scale;
+
+    const double budget = hc.max_memory_mb * 1024. * 1024.;
+    if (estimate_hollowing_memory(mesh_area, voxel_scale, hc) <= budget)
+        return voxel_scale;
+
+    // The estimate grows monotonically with the voxel scale.
+    double lo = min_voxel_scale(hc), hi = voxel_scale;
+    if (estimate_hollowing_memory(mesh_area, lo, hc) > budget) {
+        BOOST_LOG_TRIVIAL(warning) << "Hollowing: the memory limit of " << hc.max_memory_mb
+                                   << " MB is not achievable, using the lowest voxel scale " << lo;
+        return lo;
+    }
+
+    for (int i = 0; i < 32 && hi - lo > 1e-3 * hi; ++ i) {
+        double mid = (lo + hi) / 2.;
+        if (estimate_hollowing_memory(mesh_area, mid, hc) > budget)
+            hi = mid;
+        else
+            lo = mid;
+    }
+
+    BOOST_LOG_TRIVIAL(info) << "Hollowing: voxel scale lowered from " << voxel_scale << " to " << lo
+                            << " to fit into " << hc.max_memory_mb << " MB";
+
+    return lo;
+}
+
 // The same as its_compactify_vertices, but returns a new mesh, doesn't touch
 // the original
 static indexed_triangle_set
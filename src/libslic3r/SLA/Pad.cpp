@@ -481,8 +481,11 @@ void pad_blueprint(const indexed_triangle_set &mesh,
 {
     if (mesh.empty()) return;
 
-    std::vector<ExPolygons> out = slice_mesh_ex(mesh, heights, thrfn);
+    pad_blueprint(slice_mesh_ex(mesh, heights, thrfn), output);
+}
 
+void pad_blueprint(std::vector<ExPolygons> &&out, ExPolygons &output)
+{
     size_t count = 0;
     for(auto& o : out) count += o.size();
 
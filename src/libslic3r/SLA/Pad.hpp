@@ -39,6 +39,11 @@ void pad_blueprint(
     float         layerheight    = 0.05f, // The sampling height
     ThrowOnCancel thrfn          = [] {});
 
+/// Calculate the silhouette from already sliced geometry.
+void pad_blueprint(
+    std::vector<ExPolygons> &&slices,
+    ExPolygons &              output);
+
 struct PadConfig {
     double wall_thickness_mm = 1.;
     double wall_height_mm = 1.;
@@ -0,0 +1,114 @@
+#ifndef SLA_PINHEADCACHE_HPP
+#define SLA_PINHEADCACHE_HPP
+
+#include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <boost/functional/hash.hpp>
+
+#include <libslic3r/SLA/SupportTree.hpp>
+#include <libslic3r/SLA/SupportTreeBuilder.hpp>
+
+namespace Slic3r { namespace sla {
+
+// Pinhead placements of the support points from the previous support tree
+// builds over the same mesh. The placement of a pinhead (the orientation
+// and the length of the head avoiding the model) depends only on its support
+// point, the mesh and the head parameters, and it is the most expensive part
+// of the support tree generation. When the support points are edited, only
+// the added or moved points need to be placed again.
+// Shared by the threads placing the pinheads.
+class PinheadCache
+{
+public:
+    // Drop the placements computed with different head parameters or over
+    // another ground level and the placements of the removed support points.
+    void update(const SupportableMesh &sm)
+    {
+        Signature sig { sm.cfg.tree_type,
+                        sm.cfg.head_front_radius_mm,
+                        sm.cfg.head_back_radius_mm,
+                        sm.cfg.head_fallback_radius_mm,
+                        sm.cfg.head_penetration_mm,
+                        sm.cfg.head_width_mm,
+                        sm.cfg.bridge_slope,
+                        ground_level(sm) };
+
+        std::lock_guard<std::mutex> lk(m_mutex);
+        if (! (sig == m_signature)) {
+            m_signature = sig;
+            m_placements.clear();
+            return;
+        }
+
+        std::unordered_set<Key, KeyHash> keys;
+        keys.reserve(sm.pts.size());
+        for (const SupportPoint &sp : sm.pts)
+            keys.insert(key(sp));
+        for (auto it = m_placements.begin(); it != m_placements.end();)
+            it = keys.count(it->first) ? std::next(it) : m_placements.erase(it);
+    }
+
+    // Returns false if the support point was not placed yet. Otherwise
+    // placement is the cached pinhead, empty if the point may not be supported.
+    bool find(const SupportPoint &sp, std::optional<Head> &placement) const
+    {
+        std::lock_guard<std::mutex> lk(m_mutex);
+        auto it = m_placements.find(key(sp));
+        if (it == m_placements.end())
+            return false;
+        placement = it->second;
+        return true;
+    }
+
+    void insert(const SupportPoint &sp, const std::optional<Head> &placement)
+    {
+        std::lock_guard<std::mutex> lk(m_mutex);
+        m_placements.insert_or_assign(key(sp), placement);
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> lk(m_mutex);
+        m_placements.clear();
+    }
+
+private:
+    struct Signature
+    {
+        SupportTreeType tree_type = SupportTreeType::Default;
+        double head_front_radius = 0., head_back_radius = 0., head_fallback_radius = 0.;
+        double head_penetration = 0., head_width = 0., bridge_slope = 0., ground_level = 0.;
+
+        bool operator==(const Signature &rhs) const
+        {
+            auto tie = [](const Signature &s) {
+                return std::tie(s.tree_type, s.head_front_radius, s.head_back_radius, s.head_fallback_radius,
+                                s.head_penetration, s.head_width, s.bridge_slope, s.ground_level);
+            };
+            return tie(*this) == tie(rhs);
+        }
+    };
+
+    using Key = std::tuple<float, float, float, float>;
+    struct KeyHash
+    {
+        size_t operator()(const Key &k) const { return boost::hash_value(k); }
+    };
+
+    static Key key(const SupportPoint &sp)
+    {
+        return { sp.pos.x(), sp.pos.y(), sp.pos.z(), sp.head_front_radius };
+    }
+
+    Signature                                             m_signature;
+    std::unordered_map<Key, std::optional<Head>, KeyHash> m_placements;
+    mutable std::mutex                                    m_mutex;
+};
+
+}} // namespace Slic3r::sla
+
+#endif // SLA_PINHEADCACHE_HPP
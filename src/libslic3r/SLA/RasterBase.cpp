@@ -10,31 +10,91 @@
 
 #include <libslic3r/SLA/RasterBase.hpp>
 #include <libslic3r/SLA/AGGRaster.hpp>
+#include <libslic3r/SLA/ScanlineRaster.hpp>
 
 // minz image write:
 #include <miniz.h>
 
 namespace Slic3r { namespace sla {
 
+namespace {
+
+void append_be32(std::vector<uint8_t> &buf, uint32_t v)
+{
+    for (int shift = 24; shift >= 0; shift -= 8)
+        buf.emplace_back(uint8_t(v >> shift));
+}
+
+void append_chunk_type(std::vector<uint8_t> &buf, const char *type)
+{
+    buf.insert(buf.end(), type, type + 4);
+}
+
+mz_bool append_compressed(const void *data, int len, void *user)
+{
+    auto &buf   = *static_cast<std::vector<uint8_t> *>(user);
+    auto  bytes = static_cast<const uint8_t *>(data);
+    buf.insert(buf.end(), bytes, bytes + len);
+    return MZ_TRUE;
+}
+
+} // namespace
+
+// Same PNG as tdefl_write_image_to_png_file_in_memory() writes (unfiltered
+// rows, default compression level), so the archives do not grow. The
+// compressed stream is written directly into the output buffer instead of
+// a buffer of the size of the raw image, which is then copied.
 EncodedRaster PNGRasterEncoder::operator()(const void *ptr, size_t w, size_t h,
                                            size_t      num_components)
 {
-    std::vector<uint8_t> buf;
-    size_t s = 0;
-    
-    void *rawdata = tdefl_write_image_to_png_file_in_memory(
-        ptr, int(w), int(h), int(num_components), &s);
-    
+    // IHDR color types indexed by the number of components.
+    static constexpr uint8_t color_types[] = { 0, 0, 4, 2, 6 };
+    static constexpr uint8_t signature[]   = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+    static constexpr uint8_t filter_none   = 0;
+
+    if (num_components == 0 || num_components > 4)
+        return EncodedRaster({}, "png");
+
+    std::vector<uint8_t> buf(std::begin(signature), std::end(signature));
+
+    size_t ihdr = buf.size();
+    append_be32(buf, 13);
+    append_chunk_type(buf, "IHDR");
+    append_be32(buf, uint32_t(w));
+    append_be32(buf, uint32_t(h));
+    buf.insert(buf.end(), { 8 /* bit depth */, color_types[num_components], 0, 0, 0 });
+    append_be32(buf, uint32_t(mz_crc32(MZ_CRC32_INIT, buf.data() + ihdr + 4, 17)));
+
+    // The length of the IDAT chunk is filled in after compression.
+    size_t idat = buf.size();
+    append_be32(buf, 0);
+    append_chunk_type(buf, "IDAT");
+
+    auto compressor = std::make_unique<tdefl_compressor>();
+    tdefl_init(compressor.get(), append_compressed, &buf,
+               TDEFL_DEFAULT_MAX_PROBES | TDEFL_WRITE_ZLIB_HEADER);
+
+    const size_t        row_size = w * num_components;
+    const std::uint8_t *rows     = static_cast<const std::uint8_t *>(ptr);
+    for (size_t y = 0; y < h; ++ y) {
+        tdefl_compress_buffer(compressor.get(), &filter_none, 1, TDEFL_NO_FLUSH);
+        tdefl_compress_buffer(compressor.get(), rows + y * row_size, row_size, TDEFL_NO_FLUSH);
+    }
+
     // On error, data() will return an empty vector. No other info can be
     // retrieved from miniz anyway...
-    if (rawdata == nullptr) return EncodedRaster({}, "png");
-    
-    auto pptr = static_cast<std::uint8_t*>(rawdata);
-    
-    buf.reserve(s);
-    std::copy(pptr, pptr + s, std::back_inserter(buf));
-    
-    MZ_FREE(rawdata);
+    if (tdefl_compress_buffer(compressor.get(), nullptr, 0, TDEFL_FINISH) != TDEFL_STATUS_DONE)
+        return EncodedRaster({}, "png");
+
+    auto idat_size = uint32_t(buf.size() - idat - 8);
+    for (int i = 0; i < 4; ++ i)
+        buf[idat + i] = uint8_t(idat_size >> (24 - 8 * i));
+    append_be32(buf, uint32_t(mz_crc32(MZ_CRC32_INIT, buf.data() + idat + 4, idat_size + 4)));
+
+    append_be32(buf, 0);
+    append_chunk_type(buf, "IEND");
+    append_be32(buf, 0xAE426082);
+
     return EncodedRaster(std::move(buf), "png");
 }
 
@@ -80,7 +140,7 @@ std::unique_ptr<RasterBase> create_raster_grayscale_aa(
     else if (std::abs(gamma - 1.) < 1e-6)
         rst = std::make_unique<RasterGrayscaleAA>(res, pxdim, tr, agg::gamma_none());
     else
-        rst = std::make_unique<RasterGrayscaleAA>(res, pxdim, tr, agg::gamma_threshold(.5));
+        rst = std::make_unique<RasterGrayscaleScanline>(res, pxdim, tr);
     
     return rst;
 }
@@ -112,6 +112,8 @@ struct PPMRasterEncoder {
 std::ostream& operator<<(std::ostream &stream, const EncodedRaster &bytes);
 
 // If gamma is zero, thresholding will be performed which disables AA.
+// The thresholded raster is drawn by RasterGrayscaleScanline, without the agg
+// anti-aliasing rasterizer.
 std::unique_ptr<RasterBase> create_raster_grayscale_aa(
     const Resolution        &res,
     const PixelDim          &pxdim,
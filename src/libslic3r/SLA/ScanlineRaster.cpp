@@ -0,0 +1,108 @@
+#include <libslic3r/SLA/ScanlineRaster.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+
+namespace Slic3r { namespace sla {
+
+RasterGrayscaleScanline::RasterGrayscaleScanline(const Resolution &res,
+                                                 const PixelDim   &pd,
+                                                 const Trafo      &trafo)
+    : m_resolution(res)
+    , m_pxdim(pd)
+    , m_trafo(trafo)
+    , m_buf(res.pixels(), uint8_t(0))
+    , m_scale_x(SCALING_FACTOR)
+    , m_scale_y(SCALING_FACTOR)
+{
+    assert(pd.w_mm != 0 && pd.h_mm != 0);
+    if (pd.w_mm != 0 && pd.h_mm != 0) {
+        m_scale_x /= pd.w_mm;
+        m_scale_y /= pd.h_mm;
+    }
+}
+
+// Same transformation as AGGRaster::to_path().
+void RasterGrayscaleScanline::add_edges(const Polygon &poly)
+{
+    if (poly.points.size() < 3)
+        return;
+
+    auto to_px = [this](const Point &p) {
+        Vec2d v = m_trafo.flipXY ? Vec2d(p.y() * m_scale_y, p.x() * m_scale_x) :
+                                   Vec2d(p.x() * m_scale_x, p.y() * m_scale_y);
+        v.x() += m_trafo.center_x * m_scale_x;
+        v.y() += m_trafo.center_y * m_scale_y;
+        if (m_trafo.mirror_x)
+            v.x() = double(m_resolution.width_px) - v.x();
+        if (m_trafo.mirror_y)
+            v.y() = double(m_resolution.height_px) - v.y();
+        return v;
+    };
+
+    Vec2d prev = to_px(poly.points.back());
+    for (const Point &pt : poly.points) {
+        Vec2d p = to_px(pt);
+        if (prev.y() != p.y()) {
+            const Vec2d &lo = prev.y() < p.y() ? prev : p;
+            const Vec2d &hi = prev.y() < p.y() ? p : prev;
+            m_edges.push_back({ lo.y(), hi.y(), lo.x(), (hi.x() - lo.x()) / (hi.y() - lo.y()) });
+        }
+        prev = p;
+    }
+}
+
+void RasterGrayscaleScanline::fill_row(size_t row)
+{
+    uint8_t *dst = m_buf.data() + row * m_resolution.width_px;
+    const auto w = long(m_resolution.width_px);
+    for (size_t i = 0; i + 1 < m_crossings.size(); i += 2) {
+        // Pixel x is filled if its center x + 0.5 is inside [x0, x1).
+        long x0 = std::clamp(long(std::ceil(m_crossings[i] - 0.5)), 0l, w);
+        long x1 = std::clamp(long(std::ceil(m_crossings[i + 1] - 0.5)), 0l, w);
+        if (x0 < x1)
+            std::memset(dst + x0, 0xFF, size_t(x1 - x0));
+    }
+}
+
+void RasterGrayscaleScanline::draw(const ExPolygon &poly)
+{
+    m_edges.clear();
+    add_edges(poly.contour);
+    for (const Polygon &h : poly.holes)
+        add_edges(h);
+    if (m_edges.empty())
+        return;
+
+    std::sort(m_edges.begin(), m_edges.end(), [](const Edge &l, const Edge &r) { return l.y0 < r.y0; });
+    double y_max = 0.;
+    for (const Edge &e : m_edges)
+        y_max = std::max(y_max, e.y1);
+
+    const long row_begin = std::max(0l, long(std::floor(m_edges.front().y0)));
+    const long row_end   = std::min(long(m_resolution.height_px), long(std::ceil(y_max)));
+
+    // Edge table sweep over the pixel centers: activate the edges starting
+    // below the sample row, drop the ones which ended, intersect the rest
+    // and sort the crossings. ExPolygon holes do not overlap its contour,
+    // thus the crossings pair up into the filled spans by the even-odd rule.
+    size_t next_edge = 0;
+    m_active.clear();
+    for (long row = row_begin; row < row_end; ++ row) {
+        const double y = row + 0.5;
+        for (; next_edge < m_edges.size() && m_edges[next_edge].y0 <= y; ++ next_edge)
+            m_active.push_back(next_edge);
+        m_active.erase(std::remove_if(m_active.begin(), m_active.end(),
+                                      [this, y](size_t i) { return m_edges[i].y1 <= y; }),
+                       m_active.end());
+        m_crossings.clear();
+        for (size_t i : m_active)
+            m_crossings.push_back(m_edges[i].x_at(y));
+        std::sort(m_crossings.begin(), m_crossings.end());
+        fill_row(size_t(row));
+    }
+}
+
+}} // namespace Slic3r::sla
@@ -0,0 +1,75 @@
+#ifndef SLA_SCANLINERASTER_HPP
+#define SLA_SCANLINERASTER_HPP
+
+#include <libslic3r/SLA/RasterBase.hpp>
+
+namespace Slic3r { namespace sla {
+
+/*
+ * Monochrome raster without anti-aliasing. Polygons are filled by an edge
+ * table scanline converter writing whole spans of white pixels into the 8-bit
+ * grayscale buffer, which is considerably cheaper than the per cell coverage
+ * computation of the agg anti-aliasing rasterizer.
+ *
+ * A pixel is white if its center is inside the polygon. This is the result of
+ * the agg rasterizer thresholded in the middle (gamma_threshold(.5)) except
+ * for the pixels the polygon edge cuts exactly in halves.
+ *
+ * The output layout and the display transformation (RasterBase::Trafo) are
+ * the same as for RasterGrayscaleAA, so the raster may be used with any
+ * of the raster encoders.
+ */
+class RasterGrayscaleScanline : public RasterBase {
+public:
+    RasterGrayscaleScanline(const Resolution &res,
+                            const PixelDim   &pd,
+                            const Trafo      &trafo);
+
+    Trafo      trafo() const override { return m_trafo; }
+    Resolution resolution() const { return m_resolution; }
+    PixelDim   pixel_dimensions() const { return m_pxdim; }
+
+    void draw(const ExPolygon &poly) override;
+
+    EncodedRaster encode(RasterEncoder encoder) const override
+    {
+        return encoder(m_buf.data(), m_resolution.width_px, m_resolution.height_px, 1);
+    }
+
+    uint8_t read_pixel(size_t col, size_t row) const
+    {
+        return m_buf[row * m_resolution.width_px + col];
+    }
+
+    void clear() { std::fill(m_buf.begin(), m_buf.end(), uint8_t(0)); }
+
+private:
+    // Polygon edge in pixel coordinates, oriented upwards (y0 < y1).
+    struct Edge {
+        double y0, y1;
+        double x0;
+        double dxdy;
+        double x_at(double y) const { return x0 + (y - y0) * dxdy; }
+    };
+
+    void add_edges(const Polygon &poly);
+    // Fill the spans between the pairs of m_crossings into the row.
+    void fill_row(size_t row);
+
+    Resolution           m_resolution;
+    PixelDim             m_pxdim;
+    Trafo                m_trafo;
+    std::vector<uint8_t> m_buf;
+
+    // Scaled coordinates to pixels.
+    double            m_scale_x, m_scale_y;
+
+    // Buffers reused by the subsequent draw() calls.
+    std::vector<Edge>   m_edges;
+    std::vector<size_t> m_active;
+    std::vector<double> m_crossings;
+};
+
+}} // namespace Slic3r::sla
+
+#endif // SLA_SCANLINERASTER_HPP
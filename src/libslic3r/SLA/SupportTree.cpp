@@ -13,6 +13,8 @@
 #include <libslic3r/SLA/SupportTreeBuilder.hpp>
 #include <libslic3r/SLA/DefaultSupportTree.hpp>
 #include <libslic3r/SLA/BranchingTreeSLA.hpp>
+#include <libslic3r/SLA/SupportTreeSlicer.hpp>
+#include <libslic3r/SLA/PinheadCache.hpp>
 
 #include <libslic3r/MTUtils.hpp>
 #include <libslic3r/ClipperUtils.hpp>
@@ -26,8 +28,8 @@
 
 namespace Slic3r { namespace sla {
 
-indexed_triangle_set create_support_tree(const SupportableMesh &sm,
-                                         const JobController   &ctl)
+std::unique_ptr<SupportTreeBuilder> build_support_tree(const SupportableMesh &sm,
+                                                       const JobController   &ctl)
 {
     auto builder = make_unique<SupportTreeBuilder>(ctl);
 
@@ -35,6 +37,9 @@ indexed_triangle_set create_support_tree(const SupportableMesh &sm,
         Benchmark bench;
         bench.start();
 
+        if (sm.pinhead_cache)
+            sm.pinhead_cache->update(sm);
+
         switch (sm.cfg.tree_type) {
         case SupportTreeType::Default: {
             create_default_tree(*builder, sm);
@@ -55,18 +60,29 @@ indexed_triangle_set create_support_tree(const SupportableMesh &sm,
         BOOST_LOG_TRIVIAL(info) << "Support tree creation took: "
                                 << bench.getElapsedSec()
                                 << " seconds";
+    }
+
+    return builder;
+}
 
+indexed_triangle_set create_support_tree(const SupportableMesh &sm,
+                                         const JobController   &ctl)
+{
+    auto builder = build_support_tree(sm, ctl);
+
+    if (sm.cfg.enabled)
         builder->merge_and_cleanup();   // clean metadata, leave only the meshes.
-    }
 
     indexed_triangle_set out = builder->retrieve_mesh(MeshType::Support);
 
     return out;
 }
 
-indexed_triangle_set create_pad(const SupportableMesh      &sm,
-                                const indexed_triangle_set &support_mesh,
-                                const JobController        &ctl)
+// sup_blueprint_fn(heights, output) samples the supports at the pad heights.
+template<class SupBlueprintFn>
+static indexed_triangle_set create_pad(const SupportableMesh &sm,
+                                       const JobController   &ctl,
+                                       SupBlueprintFn       &&sup_blueprint_fn)
 {
     constexpr float PadSamplingLH = 0.1f;
 
@@ -87,7 +103,7 @@ indexed_triangle_set create_pad(const SupportableMesh      &sm,
     }
 
     ExPolygons sup_contours;
-    pad_blueprint(support_mesh, sup_contours, heights, ctl.cancelfn);
+    sup_blueprint_fn(heights, sup_contours);
 
     indexed_triangle_set out;
     create_pad(sup_contours, model_contours, out, sm.pad_cfg);
@@ -100,20 +116,38 @@ indexed_triangle_set create_pad(const SupportableMesh      &sm,
     return out;
 }
 
-std::vector<ExPolygons> slice(const indexed_triangle_set &sup_mesh,
-                              const indexed_triangle_set &pad_mesh,
-                              const std::vector<float>   &grid,
-                              float                       cr,
-                              const JobController        &ctl)
+indexed_triangle_set create_pad(const SupportableMesh      &sm,
+                                const indexed_triangle_set &support_mesh,
+                                const JobController        &ctl)
+{
+    return create_pad(sm, ctl, [&support_mesh, &ctl](const std::vector<float> &heights, ExPolygons &out) {
+        pad_blueprint(support_mesh, out, heights, ctl.cancelfn);
+    });
+}
+
+indexed_triangle_set create_pad(const SupportableMesh    &sm,
+                                const SupportTreeBuilder &support_tree,
+                                const JobController      &ctl)
+{
+    return create_pad(sm, ctl, [&support_tree, &ctl](const std::vector<float> &heights, ExPolygons &out) {
+        if (! support_tree.empty())
+            pad_blueprint(slice(support_tree, heights, ctl), out);
+    });
+}
+
+// slice_supports(slices) appends the support slices, if there are any.
+template<class SliceSupportsFn>
+static std::vector<ExPolygons> slice_with_pad(SliceSupportsFn          &&slice_supports,
+                                              const indexed_triangle_set &pad_mesh,
+                                              const std::vector<float>   &grid,
+                                              float                       cr,
+                                              const JobController        &ctl)
 {
     using Slices = std::vector<ExPolygons>;
 
     auto slices = reserve_vector<Slices>(2);
 
-    if (!sup_mesh.empty()) {
-        slices.emplace_back();
-        slices.back() = slice_mesh_ex(sup_mesh, grid, cr, ctl.cancelfn);
-    }
+    slice_supports(slices);
 
     if (!pad_mesh.empty()) {
         slices.emplace_back();
@@ -148,4 +182,34 @@ std::vector<ExPolygons> slice(const indexed_triangle_set &sup_mesh,
     return mrg;
 }
 
+std::vector<ExPolygons> slice(const indexed_triangle_set &sup_mesh,
+                              const indexed_triangle_set &pad_mesh,
+                              const std::vector<float>   &grid,
+                              float                       cr,
+                              const JobController        &ctl)
+{
+    return slice_with_pad([&](std::vector<std::vector<ExPolygons>> &slices) {
+        if (!sup_mesh.empty())
+            slices.emplace_back(slice_mesh_ex(sup_mesh, grid, cr, ctl.cancelfn));
+    }, pad_mesh, grid, cr, ctl);
+}
+
+std::vector<ExPolygons> slice(const SupportTreeBuilder   &support_tree,
+                              const indexed_triangle_set &pad_mesh,
+                              const std::vector<float>   &grid,
+                              float                       cr,
+                              const JobController        &ctl,
+                              SupportSlicesCache         *cache)
+{
+    // The sections of the primitives are exact, there are no gaps to close.
+    return slice_with_pad([&](std::vector<std::vector<ExPolygons>> &slices) {
+        if (support_tree.empty()) {
+            if (cache)
+                cache->clear();
+        } else
+            slices.emplace_back(cache ? slice(support_tree, grid, ctl, *cache) :
+                                        slice(support_tree, grid, ctl));
+    }, pad_mesh, grid, cr, ctl);
+}
+
 }} // namespace Slic3r::sla
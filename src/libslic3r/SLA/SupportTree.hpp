@@ -114,6 +114,8 @@ struct SupportTreeConfig
 
 enum class MeshType { Support, Pad };
 
+class PinheadCache;
+
 struct SupportableMesh
 {
     AABBMesh          emesh;
@@ -122,6 +124,10 @@ struct SupportableMesh
     PadConfig         pad_cfg;
     double            zoffset = 0.;
 
+    // Optional pinhead placements of the previous builds over the same mesh,
+    // see PinheadCache.hpp.
+    std::shared_ptr<PinheadCache> pinhead_cache;
+
     explicit SupportableMesh(const indexed_triangle_set &trmsh,
                              const SupportPoints        &sp,
                              const SupportTreeConfig    &c)
@@ -144,6 +150,15 @@ inline double ground_level(const SupportableMesh &sm)
     return lvl;
 }
 
+class SupportTreeBuilder;
+struct SupportSlicesCache;
+
+// The support tree primitives. The support mesh is generated from them on
+// demand (see SupportTreeBuilder::merged_mesh()), the supports are sliced
+// from the primitives directly (see SupportTreeSlicer.hpp).
+std::unique_ptr<SupportTreeBuilder> build_support_tree(const SupportableMesh &mesh,
+                                                       const JobController   &ctl);
+
 indexed_triangle_set create_support_tree(const SupportableMesh &mesh,
                                          const JobController   &ctl);
 
@@ -151,12 +166,25 @@ indexed_triangle_set create_pad(const SupportableMesh      &model_mesh,
                                 const indexed_triangle_set &support_mesh,
                                 const JobController        &ctl);
 
+indexed_triangle_set create_pad(const SupportableMesh    &model_mesh,
+                                const SupportTreeBuilder &support_tree,
+                                const JobController      &ctl);
+
 std::vector<ExPolygons> slice(const indexed_triangle_set &support_mesh,
                               const indexed_triangle_set &pad_mesh,
                               const std::vector<float>   &grid,
                               float                       closing_radius,
                               const JobController        &ctl);
 
+// Same as above, with the supports sliced from the support tree primitives.
+// With a cache, only the layers changed since the previous call are sliced.
+std::vector<ExPolygons> slice(const SupportTreeBuilder   &support_tree,
+                              const indexed_triangle_set &pad_mesh,
+                              const std::vector<float>   &grid,
+                              float                       closing_radius,
+                              const JobController        &ctl,
+                              SupportSlicesCache         *cache = nullptr);
+
 } // namespace sla
 } // namespace Slic3r
 
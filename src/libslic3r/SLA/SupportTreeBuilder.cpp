@@ -84,10 +84,8 @@ void SupportTreeBuilder::add_pillar_base(long pid, double baseheight, double rad
     m_meshcache_valid = false;
 }
 
-const indexed_triangle_set &SupportTreeBuilder::merged_mesh(size_t steps) const
+indexed_triangle_set SupportTreeBuilder::generate_mesh(size_t steps) const
 {
-    if (m_meshcache_valid) return m_meshcache;
-    
     indexed_triangle_set merged;
     
     for (auto &head : m_heads) {
@@ -130,17 +128,24 @@ const indexed_triangle_set &SupportTreeBuilder::merged_mesh(size_t steps) const
         its_merge(merged, get_mesh(anch, steps));
     }
 
-    if (ctl().stopcondition()) {
-        // In case of failure we have to return an empty mesh
-        m_meshcache = {};
-        return m_meshcache;
-    }
-    
-    m_meshcache = std::move(merged);
-    
+    // In case of failure we have to return an empty mesh
+    if (ctl().stopcondition())
+        return {};
+
     // The mesh will be passed by const-pointer to TriangleMeshSlicer,
     // which will need this.
-    its_merge_vertices(m_meshcache);
+    its_merge_vertices(merged);
+
+    return merged;
+}
+
+const indexed_triangle_set &SupportTreeBuilder::merged_mesh(size_t steps) const
+{
+    if (m_meshcache_valid) return m_meshcache;
+
+    m_meshcache = generate_mesh(steps);
+    if (ctl().stopcondition())
+        return m_meshcache;
     
     BoundingBoxf3 bb = bounding_box(m_meshcache);
     m_model_height   = bb.max(Z) - bb.min(Z);
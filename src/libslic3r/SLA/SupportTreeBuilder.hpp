@@ -399,6 +399,21 @@ public:
     inline const std::vector<Head>   &heads() const { return m_heads; }
     inline const std::vector<Bridge> &bridges() const { return m_bridges; }
     inline const std::vector<Bridge> &crossbridges() const { return m_crossbridges; }
+    inline const std::vector<DiffBridge> &diffbridges() const { return m_diffbridges; }
+    inline const std::vector<Junction> &junctions() const { return m_junctions; }
+    inline const std::vector<Pedestal> &pedestals() const { return m_pedestals; }
+    inline const std::vector<Anchor> &anchors() const { return m_anchors; }
+
+    bool empty() const
+    {
+        return m_heads.empty() && m_pillars.empty() && m_junctions.empty() &&
+               m_bridges.empty() && m_crossbridges.empty() &&
+               m_diffbridges.empty() && m_pedestals.empty() && m_anchors.empty();
+    }
+
+    // The job controller of the tree creation is not valid anymore once the
+    // tree is created, the tree may be meshed or sliced later on.
+    void reset_ctl(const JobController &ctl = {}) { m_ctl = ctl; }
     
     template<class T> inline IntegerOnly<T, const Pillar&> pillar(T id) const
     {
@@ -420,6 +435,9 @@ public:
 
     // WITHOUT THE PAD!!!
     const indexed_triangle_set &merged_mesh(size_t steps = 45) const;
+
+    // Same as merged_mesh(), but the result is not cached.
+    indexed_triangle_set generate_mesh(size_t steps = 45) const;
     
     // Intended to be called after the generation is fully complete
     const indexed_triangle_set & merge_and_cleanup();
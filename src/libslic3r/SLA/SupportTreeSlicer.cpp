@@ -0,0 +1,348 @@
+#include <libslic3r/SLA/SupportTreeSlicer.hpp>
+#include <libslic3r/SLA/SupportTreeBuilder.hpp>
+
+#include <libslic3r/ClipperUtils.hpp>
+#include <libslic3r/Execution/ExecutionTBB.hpp>
+#include <libslic3r/Geometry/ConvexHull.hpp>
+
+#include <boost/log/trivial.hpp>
+
+#include <array>
+#include <atomic>
+#include <optional>
+
+namespace Slic3r { namespace sla {
+
+namespace {
+
+struct Sphere
+{
+    Vec3d  center;
+    double r;
+};
+
+// Frustum of a cone with flat caps perpendicular to its axis, a cylinder
+// if both radii are equal.
+struct Frustum
+{
+    Vec3d  center0, center1;
+    double r0, r1;
+};
+
+// A support tree primitive as the convex hull of at most two spheres and
+// a frustum. The section of the primitive by a plane is the convex hull
+// of the sections of its parts.
+class ConvexSolid
+{
+public:
+    void add(const Sphere &s)
+    {
+        assert(m_num_spheres < m_spheres.size());
+        m_spheres[m_num_spheres ++] = s;
+        m_zmin = std::min(m_zmin, s.center.z() - s.r);
+        m_zmax = std::max(m_zmax, s.center.z() + s.r);
+    }
+
+    void add(const Frustum &f)
+    {
+        m_frustum = f;
+        // Z extent of a cap circle of radius r perpendicular to the axis.
+        Vec3d  axis     = (f.center1 - f.center0).normalized();
+        double cap_tilt = std::sqrt(std::max(0., 1. - axis.z() * axis.z()));
+        for (auto [c, r] : { std::make_pair(f.center0, f.r0), std::make_pair(f.center1, f.r1) }) {
+            m_zmin = std::min(m_zmin, c.z() - r * cap_tilt);
+            m_zmax = std::max(m_zmax, c.z() + r * cap_tilt);
+        }
+    }
+
+    bool   empty() const { return m_num_spheres == 0 && ! m_frustum; }
+    double zmin() const { return m_zmin; }
+    double zmax() const { return m_zmax; }
+
+    // The defining parameters: the numbers of the spheres and frustums,
+    // the centers and the radii of the spheres, the centers and the radii
+    // of the frustum caps. Unused entries are zero. Solids with equal
+    // parameters have equal sections.
+    using Parameters = SupportSlicesCache::SolidParameters;
+    Parameters parameters() const
+    {
+        Parameters ret {};
+        auto       it  = ret.begin();
+        auto       add = [&it](const Vec3d &c, double r) {
+            for (double v : { c.x(), c.y(), c.z(), r })
+                *it ++ = v;
+        };
+        *it ++ = double(m_num_spheres);
+        *it ++ = m_frustum ? 1. : 0.;
+        for (size_t i = 0; i < m_num_spheres; ++ i)
+            add(m_spheres[i].center, m_spheres[i].r);
+        it = ret.begin() + 10;
+        if (m_frustum) {
+            add(m_frustum->center0, m_frustum->r0);
+            add(m_frustum->center1, m_frustum->r1);
+        }
+        return ret;
+    }
+
+    // Section by a horizontal plane at z, empty polygon if the plane misses
+    // the solid.
+    Polygon section(double z, size_t steps) const
+    {
+        Points pts;
+        for (size_t i = 0; i < m_num_spheres; ++ i)
+            section_points(m_spheres[i], z, steps, pts);
+        if (m_frustum)
+            section_points(*m_frustum, z, steps, pts);
+
+        return pts.size() < 3 ? Polygon{} : Geometry::convex_hull(std::move(pts));
+    }
+
+private:
+    static Vec3d circle_point(const Vec3d &e1, const Vec3d &e2, double phi)
+    {
+        return std::cos(phi) * e1 + std::sin(phi) * e2;
+    }
+
+    static void section_points(const Sphere &s, double z, size_t steps, Points &out)
+    {
+        double dz = z - s.center.z();
+        double r2 = s.r * s.r - dz * dz;
+        if (r2 <= 0.)
+            return;
+
+        double r = std::sqrt(r2);
+        for (size_t i = 0; i < steps; ++ i) {
+            double phi = 2. * PI * double(i) / double(steps);
+            out.emplace_back(Point::new_scale(s.center.x() + r * std::cos(phi), s.center.y() + r * std::sin(phi)));
+        }
+    }
+
+    static void section_points(const Frustum &f, double z, size_t steps, Points &out)
+    {
+        Vec3d  axis = f.center1 - f.center0;
+        double len  = axis.norm();
+        if (len < EPSILON)
+            return;
+
+        axis /= len;
+        Vec3d e1 = axis.unitOrthogonal();
+        Vec3d e2 = axis.cross(e1);
+
+        // The lateral surface, sampled by the rulings of the frustum.
+        for (size_t i = 0; i < steps; ++ i) {
+            Vec3d  u  = circle_point(e1, e2, 2. * PI * double(i) / double(steps));
+            Vec3d  p  = f.center0 + f.r0 * u;
+            Vec3d  q  = f.center1 + f.r1 * u;
+            if ((p.z() - z) * (q.z() - z) > 0.)
+                continue;
+            double dz = q.z() - p.z();
+            if (std::abs(dz) > EPSILON) {
+                out.emplace_back(Point::new_scale(p + (q - p) * ((z - p.z()) / dz)));
+            } else {
+                // The ruling lies in the slicing plane.
+                out.emplace_back(Point::new_scale(p));
+                out.emplace_back(Point::new_scale(q));
+            }
+        }
+
+        // End points of the chords cut from the caps. Solve
+        // c.z + r * (cos(phi) * e1.z + sin(phi) * e2.z) = z for phi.
+        for (auto [c, r] : { std::make_pair(f.center0, f.r0), std::make_pair(f.center1, f.r1) }) {
+            double a   = r * e1.z();
+            double b   = r * e2.z();
+            double amp = std::sqrt(a * a + b * b);
+            double rhs = z - c.z();
+            if (amp < EPSILON || std::abs(rhs) > amp)
+                continue;
+            double phi   = std::atan2(b, a);
+            double delta = std::acos(rhs / amp);
+            for (double t : { phi - delta, phi + delta })
+                out.emplace_back(Point::new_scale(c + r * circle_point(e1, e2, t)));
+        }
+    }
+
+    std::array<Sphere, 2>   m_spheres;
+    size_t                  m_num_spheres = 0;
+    std::optional<Frustum>  m_frustum;
+    double                  m_zmin = std::numeric_limits<double>::max();
+    double                  m_zmax = std::numeric_limits<double>::lowest();
+};
+
+// The cone tangent to both spheres, which closes their convex hull.
+std::optional<Frustum> tangent_frustum(const Sphere &s0, const Sphere &s1)
+{
+    Vec3d  v = s1.center - s0.center;
+    double d = v.norm();
+    if (d < EPSILON)
+        return {};
+
+    double sin_b = (s0.r - s1.r) / d;
+    if (std::abs(sin_b) >= 1.)
+        // One sphere contains the other.
+        return {};
+
+    double cos_b = std::sqrt(1. - sin_b * sin_b);
+    Vec3d  a     = v / d;
+    return Frustum{ s0.center + s0.r * sin_b * a, s1.center + s1.r * sin_b * a, s0.r * cos_b, s1.r * cos_b };
+}
+
+// See get_mesh(const Head&) and pinhead() in SupportTreeMesher.cpp for
+// the placement of the back and the pin spheres.
+ConvexSolid head_solid(const Head &h)
+{
+    ConvexSolid ret;
+    Sphere back { h.pos + (h.fullwidth() - h.r_back_mm) * h.dir, h.r_back_mm };
+    Sphere pin  { h.pos + (h.r_pin_mm - h.penetration_mm) * h.dir, h.r_pin_mm };
+    ret.add(back);
+    ret.add(pin);
+    if (auto f = tangent_frustum(back, pin))
+        ret.add(*f);
+
+    return ret;
+}
+
+ConvexSolid frustum_solid(const Vec3d &c0, double r0, const Vec3d &c1, double r1)
+{
+    ConvexSolid ret;
+    if (r0 > 0. || r1 > 0.)
+        ret.add(Frustum{ c0, c1, r0, r1 });
+
+    return ret;
+}
+
+ConvexSolid sphere_solid(const Vec3d &c, double r)
+{
+    ConvexSolid ret;
+    if (r > EPSILON)
+        ret.add(Sphere{ c, r });
+
+    return ret;
+}
+
+// The primitives which would be meshed by SupportTreeBuilder::merged_mesh().
+std::vector<ConvexSolid> collect_solids(const SupportTreeBuilder &tree)
+{
+    std::vector<ConvexSolid> ret;
+    ret.reserve(tree.heads().size() + tree.pillars().size() + tree.pedestals().size() +
+                tree.junctions().size() + tree.bridges().size() + tree.crossbridges().size() +
+                tree.diffbridges().size() + tree.anchors().size());
+
+    for (const Head &h : tree.heads())
+        if (h.is_valid())
+            ret.emplace_back(head_solid(h));
+
+    for (const Pillar &p : tree.pillars())
+        if (p.height > EPSILON)
+            ret.emplace_back(frustum_solid(p.endpt, p.r_end, p.startpoint(), p.r_start));
+
+    for (const Pedestal &p : tree.pedestals())
+        if (p.height > 0.)
+            ret.emplace_back(frustum_solid(p.pos, p.r_bottom, p.pos + Vec3d{ 0., 0., p.height }, p.r_top));
+
+    for (const Junction &j : tree.junctions())
+        ret.emplace_back(sphere_solid(j.pos, j.r));
+
+    for (const std::vector<Bridge> *bridges : { &tree.bridges(), &tree.crossbridges() })
+        for (const Bridge &br : *bridges)
+            ret.emplace_back(frustum_solid(br.startp, br.r, br.endp, br.r));
+
+    for (const DiffBridge &br : tree.diffbridges())
+        ret.emplace_back(frustum_solid(br.startp, br.r, br.endp, br.end_r));
+
+    for (const Anchor &a : tree.anchors())
+        ret.emplace_back(head_solid(a));
+
+    ret.erase(std::remove_if(ret.begin(), ret.end(), [](const ConvexSolid &s) { return s.empty(); }), ret.end());
+    return ret;
+}
+
+} // namespace
+
+static std::vector<ExPolygons> slice(const SupportTreeBuilder &tree,
+                                     const std::vector<float> &grid,
+                                     const JobController      &ctl,
+                                     SupportSlicesCache       *cache,
+                                     size_t                    steps)
+{
+    std::vector<ExPolygons> ret(grid.size());
+    std::vector<ConvexSolid> solids = collect_solids(tree);
+    if (solids.empty() && cache == nullptr)
+        return ret;
+
+    // Z interval index: the solids reaching each slicing plane.
+    std::vector<std::vector<size_t>> solids_by_layer(grid.size());
+    for (size_t idx = 0; idx < solids.size(); ++ idx) {
+        auto it_begin = std::lower_bound(grid.begin(), grid.end(), solids[idx].zmin());
+        auto it_end   = std::upper_bound(it_begin, grid.end(), solids[idx].zmax());
+        for (auto it = it_begin; it != it_end; ++ it)
+            solids_by_layer[it - grid.begin()].emplace_back(idx);
+    }
+
+    // The layers of the previous slicing may only be reused at the same heights.
+    const bool reuse = cache && cache->grid == grid && cache->steps == steps &&
+                       cache->layer_solids.size() == grid.size() && cache->slices.size() == grid.size();
+    std::vector<ConvexSolid::Parameters> solid_parameters;
+    std::vector<std::vector<uint32_t>>   layer_solids(cache ? grid.size() : 0);
+    std::atomic<size_t>                  num_reused { 0 };
+    if (cache) {
+        solid_parameters.reserve(solids.size());
+        for (const ConvexSolid &solid : solids)
+            solid_parameters.emplace_back(solid.parameters());
+    }
+
+    execution::for_each(ex_tbb, size_t(0), grid.size(), [&](size_t layer_id) {
+        ctl.cancelfn();
+        if (cache) {
+            // The solids reaching this layer, sorted by their parameters to not depend on the order of the solids.
+            std::vector<uint32_t> &layer = layer_solids[layer_id];
+            layer.assign(solids_by_layer[layer_id].begin(), solids_by_layer[layer_id].end());
+            std::sort(layer.begin(), layer.end(),
+                      [&solid_parameters](uint32_t i1, uint32_t i2) { return solid_parameters[i1] < solid_parameters[i2]; });
+            if (reuse) {
+                const std::vector<uint32_t> &layer_old = cache->layer_solids[layer_id];
+                if (std::equal(layer.begin(), layer.end(), layer_old.begin(), layer_old.end(),
+                               [&solid_parameters, cache](uint32_t idx, uint32_t idx_old) { return solid_parameters[idx] == cache->solids[idx_old]; })) {
+                    ret[layer_id] = cache->slices[layer_id];
+                    ++ num_reused;
+                    return;
+                }
+            }
+        }
+        Polygons sections;
+        sections.reserve(solids_by_layer[layer_id].size());
+        for (size_t idx : solids_by_layer[layer_id])
+            if (Polygon section = solids[idx].section(grid[layer_id], steps); ! section.empty())
+                sections.emplace_back(std::move(section));
+        ret[layer_id] = union_ex(sections);
+    });
+
+    if (cache) {
+        BOOST_LOG_TRIVIAL(debug) << "Support tree slicing reused " << num_reused << " of " << grid.size() << " layers";
+        cache->grid         = grid;
+        cache->steps        = steps;
+        cache->solids       = std::move(solid_parameters);
+        cache->layer_solids = std::move(layer_solids);
+        cache->slices       = ret;
+    }
+
+    return ret;
+}
+
+std::vector<ExPolygons> slice(const SupportTreeBuilder &tree,
+                              const std::vector<float> &grid,
+                              const JobController      &ctl,
+                              size_t                    steps)
+{
+    return slice(tree, grid, ctl, nullptr, steps);
+}
+
+std::vector<ExPolygons> slice(const SupportTreeBuilder &tree,
+                              const std::vector<float> &grid,
+                              const JobController      &ctl,
+                              SupportSlicesCache       &cache,
+                              size_t                    steps)
+{
+    return slice(tree, grid, ctl, &cache, steps);
+}
+
+}} // namespace Slic3r::sla
@@ -0,0 +1,57 @@
+#ifndef SLA_SUPPORTTREESLICER_HPP
+#define SLA_SUPPORTTREESLICER_HPP
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+#include <libslic3r/ExPolygon.hpp>
+#include <libslic3r/SLA/JobController.hpp>
+
+namespace Slic3r { namespace sla {
+
+class SupportTreeBuilder;
+
+// Slice the support tree without meshing it. Every primitive of the tree
+// (head, pillar, pedestal, junction, bridge, anchor) is a convex solid
+// bounded by spheres, cones and planes, thus it is intersected with the
+// slicing planes analytically and the sections of all the primitives
+// reaching a slicing plane are merged. The circles are discretized with
+// the same number of steps as the support mesh (see SupportTreeMesher.hpp).
+std::vector<ExPolygons> slice(const SupportTreeBuilder &tree,
+                              const std::vector<float> &grid,
+                              const JobController      &ctl,
+                              size_t                    steps = 45);
+
+// The support slices of the previous slice() call with the parameters
+// (centers and radii) of the primitives reaching each slicing plane.
+struct SupportSlicesCache
+{
+    // Numbers of the spheres and frustums, centers and radii of a primitive.
+    using SolidParameters = std::array<double, 18>;
+
+    std::vector<float>                 grid;
+    size_t                             steps = 0;
+    // The parameters of each primitive, stored once.
+    std::vector<SolidParameters>       solids;
+    // Indices into solids of the primitives reaching each slicing plane,
+    // sorted by their parameters.
+    std::vector<std::vector<uint32_t>> layer_solids;
+    std::vector<ExPolygons>            slices;
+
+    void clear() { *this = {}; }
+};
+
+// Slice the support tree, reusing the cached slices of the layers reached
+// by the same primitives as in the previous call, thus after a local edit
+// of the supports only the layers the edit touches are sliced again.
+// The cache is updated with the new slices.
+std::vector<ExPolygons> slice(const SupportTreeBuilder &tree,
+                              const std::vector<float> &grid,
+                              const JobController      &ctl,
+                              SupportSlicesCache       &cache,
+                              size_t                    steps = 45);
+
+}} // namespace Slic3r::sla
+
+#endif // SLA_SUPPORTTREESLICER_HPP
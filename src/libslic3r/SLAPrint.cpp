@@ -855,6 +855,7 @@ bool SLAPrintObject::invalidate_state_by_config_options(const std::vector<t_conf
             || opt_key == "hollowing_min_thickness"
             || opt_key == "hollowing_quality"
             || opt_key == "hollowing_closing_distance"
+            || opt_key == "hollowing_max_memory"
             ) {
             steps.emplace_back(slaposHollowing);
         } else if (
@@ -1064,11 +1065,18 @@ const TriangleMesh& SLAPrintObject::support_mesh() const
     if (m_config.supports_enable.getBool() &&
         is_step_done(slaposSupportTree) &&
         m_supportdata)
-        return m_supportdata->tree_mesh;
+        return m_supportdata->tree_mesh();
 
     return EMPTY_MESH;
 }
 
+bool SLAPrintObject::has_support_tree() const
+{
+    return m_config.supports_enable.getBool() &&
+           is_step_done(slaposSupportTree) &&
+           m_supportdata && ! m_supportdata->tree->empty();
+}
+
 const TriangleMesh& SLAPrintObject::pad_mesh() const
 {
     if(m_config.pad_enable.getBool() && is_step_done(slaposPad) && m_supportdata)
@@ -1135,6 +1143,8 @@ DynamicConfig SLAPrintStatistics::config() const
     config.set_key_value("support_used_material", new ConfigOptionFloat(this->support_used_material));
     config.set_key_value("total_cost", new ConfigOptionFloat(this->total_cost));
     config.set_key_value("total_weight", new ConfigOptionFloat(this->total_weight));
+    config.set_key_value("encoded_layers_size", new ConfigOptionFloat(double(this->encoded_layers_size)));
+    config.set_key_value("layers_encoding_time", new ConfigOptionFloat(this->layers_encoding_time));
     return config;
 }
 
@@ -1143,7 +1153,8 @@ DynamicConfig SLAPrintStatistics::placeholders()
     DynamicConfig config;
     for (const char *key : {
         "print_time", "total_cost", "total_weight",
-        "objects_used_material", "support_used_material" })
+        "objects_used_material", "support_used_material",
+        "encoded_layers_size", "layers_encoding_time" })
         config.set_key_value(key, new ConfigOptionString(std::string("{") + key + "}"));
 
     return config;
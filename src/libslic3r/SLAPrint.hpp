@@ -12,6 +12,9 @@
 
 #include "PrintBase.hpp"
 #include "SLA/SupportTree.hpp"
+#include "SLA/SupportTreeBuilder.hpp"
+#include "SLA/SupportTreeSlicer.hpp"
+#include "SLA/PinheadCache.hpp"
 #include "Point.hpp"
 #include "Format/SLAArchiveWriter.hpp"
 #include "GCode/ThumbnailData.hpp"
@@ -123,6 +126,8 @@ public:
     // Get a pad mesh centered around origin in XY, and with zero rotation around Z applied.
     // Support mesh is only valid if this->is_step_done(slaposPad) is true.
     const TriangleMesh&     pad_mesh() const;
+    // Is there a support tree to be meshed by support_mesh()? Cheap, does not generate the mesh.
+    bool                    has_support_tree() const;
 
     // Get the mesh that is going to be printed with all the modifications
     // like hollowing and drilled holes.
@@ -345,25 +350,63 @@ private:
     {
         sla::SupportableMesh    input; // the input
         std::vector<ExPolygons> support_slices;   // sliced supports
-        TriangleMesh tree_mesh, pad_mesh, full_mesh; // cached artifacts
+        // The support tree primitives, the supports are sliced from them.
+        std::unique_ptr<sla::SupportTreeBuilder> tree = std::make_unique<sla::SupportTreeBuilder>();
+        TriangleMesh pad_mesh, full_mesh; // cached artifacts
+        // Support slices of the previous slaposSliceSupports run. Together with
+        // the pinhead placements kept by input.pinhead_cache, an edit of a few
+        // support points only places their heads and slices the layers they touch.
+        sla::SupportSlicesCache support_slices_cache;
         
         inline SupportData(const TriangleMesh &t)
             : input{t.its, {}, {}}
-        {}
+        {
+            input.pinhead_cache = std::make_shared<sla::PinheadCache>();
+        }
 
         inline SupportData(const indexed_triangle_set &t)
             : input{t, {}, {}}
-        {}
+        {
+            input.pinhead_cache = std::make_shared<sla::PinheadCache>();
+        }
         
         void create_support_tree(const sla::JobController &ctl)
         {
-            tree_mesh = TriangleMesh{sla::create_support_tree(input, ctl)};
+            tree = sla::build_support_tree(input, ctl);
+            // The tree outlives the job, it may be meshed later on request.
+            tree->reset_ctl();
+
+            std::lock_guard<std::mutex> lk(m_tree_mesh_mutex);
+            m_tree_mesh       = {};
+            m_tree_mesh_valid = false;
         }
 
         void create_pad(const sla::JobController &ctl)
         {
-            pad_mesh = TriangleMesh{sla::create_pad(input, tree_mesh.its, ctl)};
+            pad_mesh = TriangleMesh{sla::create_pad(input, *tree, ctl)};
         }
+
+        // The support tree mesh is only needed for visualization and export
+        // of the 3D geometry. It is generated on the first request, which is
+        // the support tree step of an interactive SLAPrint. The step passes
+        // its controller to be able to cancel the meshing, a cancelled mesh
+        // is not cached.
+        const TriangleMesh& tree_mesh(const sla::JobController &ctl = {}) const
+        {
+            std::lock_guard<std::mutex> lk(m_tree_mesh_mutex);
+            if (! m_tree_mesh_valid) {
+                tree->reset_ctl(ctl);
+                m_tree_mesh       = TriangleMesh{tree->generate_mesh()};
+                m_tree_mesh_valid = ! ctl.stopcondition();
+                tree->reset_ctl();
+            }
+            return m_tree_mesh;
+        }
+
+    private:
+        mutable TriangleMesh m_tree_mesh;
+        mutable bool         m_tree_mesh_valid = false;
+        mutable std::mutex   m_tree_mesh_mutex;
     };
 
     std::unique_ptr<SupportData>  m_supportdata;
@@ -413,6 +456,10 @@ struct SLAPrintStatistics
     double                          total_cost;
     double                          total_weight;
     std::vector<double>             layers_times;
+    // Size of the encoded layer images in bytes and the time spent by encoding them in seconds,
+    // summed over all threads.
+    size_t                          encoded_layers_size;
+    double                          layers_encoding_time;
 
     // Config with the filled in print statistics.
     DynamicConfig           config() const;
@@ -430,6 +477,8 @@ struct SLAPrintStatistics
         total_cost = 0.;
         total_weight = 0.;
         layers_times.clear();
+        encoded_layers_size = 0;
+        layers_encoding_time = 0.;
     }
 };
 
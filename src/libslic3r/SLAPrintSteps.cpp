@@ -341,6 +341,7 @@ void SLAPrint::Steps::hollow_model(SLAPrintObject &po)
     double quality  = po.m_config.hollowing_quality.getFloat();
     double closing_d = po.m_config.hollowing_closing_distance.getFloat();
     sla::HollowingConfig hlwcfg{thickness, quality, closing_d};
+    hlwcfg.max_memory_mb = po.m_config.hollowing_max_memory.getFloat();
     sla::JobController ctl;
     ctl.stopcondition = [this]() { return canceled(); };
     ctl.cancelfn = [this]() { throw_if_canceled(); };
@@ -351,6 +352,9 @@ void SLAPrint::Steps::hollow_model(SLAPrintObject &po)
     if (!interior || sla::get_mesh(*interior).empty())
         BOOST_LOG_TRIVIAL(warning) << "Hollowed interior is empty!";
     else {
+        BOOST_LOG_TRIVIAL(info) << "Hollowing: interior generated using "
+                                << sla::get_peak_memory(*interior) / (1024 * 1024) << " MB";
+
         po.m_hollowing_data.reset(new SLAPrintObject::HollowingData());
         po.m_hollowing_data->interior = std::move(interior);
 
@@ -718,9 +722,17 @@ void SLAPrint::Steps::support_tree(SLAPrintObject &po)
     BOOST_LOG_TRIVIAL(debug) << "Processed support point count "
                              << po.m_supportdata->input.pts.size();
 
-    // Check the mesh for later troubleshooting.
-    if(po.support_mesh().empty())
-        BOOST_LOG_TRIVIAL(warning) << "Support mesh is empty";
+    // Check the support tree for later troubleshooting.
+    if(po.m_supportdata->tree->empty())
+        BOOST_LOG_TRIVIAL(warning) << "Support tree is empty";
+
+    // The user interface displays the supports as soon as this step is done,
+    // mesh them here instead of on the UI thread. Otherwise the mesh is only
+    // generated if the supports are exported.
+    if (m_print->interactive()) {
+        po.m_supportdata->tree_mesh(ctl);
+        throw_if_canceled();
+    }
 
     report_status(-1, _u8L("Visualizing supports"), rc);
 }
@@ -785,8 +797,9 @@ void SLAPrint::Steps::slice_supports(SLAPrintObject &po) {
         ctl.cancelfn = [this]() { throw_if_canceled(); };
 
         sd->support_slices =
-            sla::slice(sd->tree_mesh.its, sd->pad_mesh.its, heights,
-                       float(po.config().slice_closing_radius.value), ctl);
+            sla::slice(*sd->tree, sd->pad_mesh.its, heights,
+                       float(po.config().slice_closing_radius.value), ctl,
+                       &sd->support_slices_cache);
     }
 
     for (size_t i = 0; i < sd->support_slices.size() && i < po.m_slice_index.size(); ++i)
@@ -866,12 +879,15 @@ void SLAPrint::Steps::initialize_printer_input()
     // clear the rasterizer input
     printer_input.clear();
 
-    size_t mx = 0;
-    for(SLAPrintObject * o : m_print->m_objects) {
-        if(auto m = o->get_slice_index().size() > mx) mx = m;
-    }
+    size_t num_records = 0;
+    for(SLAPrintObject * o : m_print->m_objects)
+        num_records += o->get_slice_index().size();
 
-    printer_input.reserve(mx);
+    // Collect the records with their levels and group them by sorting,
+    // instead of inserting the layers one by one into the sorted vector.
+    // The stable sort keeps the order of the objects within a layer.
+    std::vector<std::pair<coord_t, const SliceRecord*>> leveled_records;
+    leveled_records.reserve(num_records);
 
     auto eps = coord_t(SCALED_EPSILON);
 
@@ -890,16 +906,18 @@ void SLAPrint::Steps::initialize_printer_input()
             // Neat trick to round the layer levels to the grid.
             lvlid = eps * (lvlid / eps);
 
-            auto it = std::lower_bound(printer_input.begin(),
-                                       printer_input.end(),
-                                       PrintLayer(lvlid));
+            leveled_records.emplace_back(lvlid, &slicerecord);
+        }
+    }
 
-            if(it == printer_input.end() || it->level() != lvlid)
-                it = printer_input.insert(it, PrintLayer(lvlid));
+    std::stable_sort(leveled_records.begin(), leveled_records.end(),
+                     [](const auto &l, const auto &r) { return l.first < r.first; });
 
+    for (const auto &[lvlid, slicerecord] : leveled_records) {
+        if (printer_input.empty() || printer_input.back().level() != lvlid)
+            printer_input.emplace_back(lvlid);
 
-            it->add(slicerecord);
-        }
+        printer_input.back().add(*slicerecord);
     }
 }
 
@@ -930,30 +948,17 @@ void SLAPrint::Steps::merge_slices_and_eval_stats() {
     const auto height         = scaled<double>(printer_config.display_height.getFloat());
     const double display_area = width*height;
 
-    double supports_volume(0.0);
-    double models_volume(0.0);
-
-    double estim_time(0.0);
-    std::vector<double> layers_times;
-    layers_times.reserve(printer_input.size());
-
-    size_t slow_layers = 0;
-    size_t fast_layers = 0;
-
-    const double delta_fade_time = (init_exp_time - exp_time) / (fade_layers_cnt + 1);
-    double fade_layer_time = init_exp_time;
-
-    execution::SpinningMutex<ExecutionTBB> mutex;
-    using Lock = std::lock_guard<decltype(mutex)>;
-
-    // Going to parallel:
-    auto printlayerfn = [this,
-            // functions and read only vars
-            area_fill, display_area, exp_time, init_exp_time, fast_tilt, slow_tilt, hv_tilt, material_config, delta_fade_time,
+    // Per layer results of the parallel merge, accumulated in the layer order
+    // afterwards as the exposure times depend on the preceding layers.
+    struct LayerStats {
+        double height       = 0.;
+        double model_area   = 0.;
+        double support_area = 0.;
+        bool   valid        = false;
+    };
+    std::vector<LayerStats> layer_stats(printer_input.size());
 
-            // write vars
-            &mutex, &models_volume, &supports_volume, &estim_time, &slow_layers,
-            &fast_layers, &fade_layer_time, &layers_times](size_t sliced_layer_cnt)
+    auto printlayerfn = [this, &layer_stats](size_t sliced_layer_cnt)
     {
         PrintLayer &layer = m_print->m_printer_input[sliced_layer_cnt];
 
@@ -962,8 +967,11 @@ void SLAPrint::Steps::merge_slices_and_eval_stats() {
 
         if(slicerecord_references.empty()) return;
 
+        LayerStats &stats = layer_stats[sliced_layer_cnt];
+        stats.valid = true;
+
         // Layer height should match for all object slices for a given level.
-        const auto l_height = double(slicerecord_references.front().get().layer_height());
+        stats.height = double(slicerecord_references.front().get().layer_height());
 
         // Calculation of the consumed material
 
@@ -998,14 +1006,15 @@ void SLAPrint::Steps::merge_slices_and_eval_stats() {
 
         }
 
-        model_polygons = union_ex(model_polygons);
-        double layer_model_area = 0;
-        for (const ExPolygon& polygon : model_polygons)
-            layer_model_area += area(polygon);
+        // The slices of a single object instance do not overlap, only the
+        // slices of several objects or instances need to be merged.
+        const SliceRecord &front = slicerecord_references.front().get();
+        if (slicerecord_references.size() > 1 ||
+            (front.print_obj() && front.print_obj()->instances().size() > 1))
+            model_polygons = union_ex(model_polygons);
 
-        if (layer_model_area < 0 || layer_model_area > 0) {
-            Lock lck(mutex); models_volume += layer_model_area * l_height;
-        }
+        for (const ExPolygon& polygon : model_polygons)
+            stats.model_area += area(polygon);
 
         if(!supports_polygons.empty()) {
             if(model_polygons.empty()) supports_polygons = union_ex(supports_polygons);
@@ -1013,76 +1022,98 @@ void SLAPrint::Steps::merge_slices_and_eval_stats() {
             // allegedly, union of subject is done withing the diff according to the pftPositive polyFillType
         }
 
-        double layer_support_area = 0;
         for (const ExPolygon& polygon : supports_polygons)
-            layer_support_area += area(polygon);
-
-        if (layer_support_area < 0 || layer_support_area > 0) {
-            Lock lck(mutex); supports_volume += layer_support_area * l_height;
+            stats.support_area += area(polygon);
+
+        // Here we can save the expensively calculated polygons for printing.
+        // Without supports the merged model slices are reused as they are.
+        if (supports_polygons.empty())
+            layer.transformed_slices(std::move(model_polygons));
+        else if (model_polygons.empty())
+            layer.transformed_slices(std::move(supports_polygons));
+        else {
+            ExPolygons trslices;
+            trslices.reserve(model_polygons.size() + supports_polygons.size());
+            for(ExPolygon& poly : model_polygons) trslices.emplace_back(std::move(poly));
+            for(ExPolygon& poly : supports_polygons) trslices.emplace_back(std::move(poly));
+
+            layer.transformed_slices(union_ex(trslices));
         }
+    };
+
+    // sequential version for debugging:
+    // for(size_t i = 0; i < m_printer_input.size(); ++i) printlayerfn(i);
+    execution::for_each(ex_tbb, size_t(0), printer_input.size(), printlayerfn);
+
+    double supports_volume(0.0);
+    double models_volume(0.0);
+
+    double estim_time(0.0);
+    std::vector<double> layers_times;
+    layers_times.reserve(printer_input.size());
+
+    size_t slow_layers = 0;
+    size_t fast_layers = 0;
+
+    const double delta_fade_time = (init_exp_time - exp_time) / (fade_layers_cnt + 1);
+    double fade_layer_time = init_exp_time;
 
-        // Here we can save the expensively calculated polygons for printing
-        ExPolygons trslices;
-        trslices.reserve(model_polygons.size() + supports_polygons.size());
-        for(ExPolygon& poly : model_polygons) trslices.emplace_back(std::move(poly));
-        for(ExPolygon& poly : supports_polygons) trslices.emplace_back(std::move(poly));
+    for (size_t sliced_layer_cnt = 0; sliced_layer_cnt < layer_stats.size(); ++ sliced_layer_cnt) {
+        const LayerStats &stats = layer_stats[sliced_layer_cnt];
+        if (! stats.valid)
+            continue;
 
-        layer.transformed_slices(union_ex(trslices));
+        const double l_height = stats.height;
+        models_volume   += stats.model_area * l_height;
+        supports_volume += stats.support_area * l_height;
 
         // Calculation of the slow and fast layers to the future controlling those values on FW
 
-        const bool is_fast_layer = (layer_model_area + layer_support_area) <= display_area*area_fill;
+        const bool is_fast_layer = (stats.model_area + stats.support_area) <= display_area*area_fill;
         const double tilt_time = material_config.material_print_speed == slamsSlow              ? slow_tilt :
                                  material_config.material_print_speed == slamsHighViscosity     ? hv_tilt   :
                                  is_fast_layer ? fast_tilt : slow_tilt;
 
-        { Lock lck(mutex);
-            if (is_fast_layer)
-                fast_layers++;
-            else
-                slow_layers++;
+        if (is_fast_layer)
+            fast_layers++;
+        else
+            slow_layers++;
 
-            // Calculation of the printing time
+        // Calculation of the printing time
 
-            double layer_times = 0.0;
-            if (sliced_layer_cnt < 3)
-                layer_times += init_exp_time;
-            else if (fade_layer_time > exp_time) {
-                fade_layer_time -= delta_fade_time;
-                layer_times += fade_layer_time;
-            }
-            else
-                layer_times += exp_time;
-            layer_times += tilt_time;
-
-            //// Per layer times (magical constants cuclulated from FW)
-
-            static double exposure_safe_delay_before{ 3.0 };
-            static double exposure_high_viscosity_delay_before{ 3.5 };
-            static double exposure_slow_move_delay_before{ 1.0 };
-
-            if (material_config.material_print_speed == slamsSlow)
-                layer_times += exposure_safe_delay_before;
-            else if (material_config.material_print_speed == slamsHighViscosity)
-                layer_times += exposure_high_viscosity_delay_before;
-            else if (!is_fast_layer)
-                layer_times += exposure_slow_move_delay_before;
-
-            // Increase layer time for "magic constants" from FW
-            layer_times += (
-                l_height * 5  // tower move
-                + 120 / 1000  // Magical constant to compensate remaining computation delay in exposure thread
-            );
-
-            layers_times.push_back(layer_times);
-            estim_time += layer_times;
+        double layer_times = 0.0;
+        if (sliced_layer_cnt < 3)
+            layer_times += init_exp_time;
+        else if (fade_layer_time > exp_time) {
+            fade_layer_time -= delta_fade_time;
+            layer_times += fade_layer_time;
         }
-    };
-
-    // sequential version for debugging:
-    // for(size_t i = 0; i < m_printer_input.size(); ++i) printlayerfn(i);
-    execution::for_each(ex_tbb, size_t(0), printer_input.size(), printlayerfn,
-                        execution::max_concurrency(ex_tbb));
+        else
+            layer_times += exp_time;
+        layer_times += tilt_time;
+
+        //// Per layer times (magical constants cuclulated from FW)
+
+        static double exposure_safe_delay_before{ 3.0 };
+        static double exposure_high_viscosity_delay_before{ 3.5 };
+        static double exposure_slow_move_delay_before{ 1.0 };
+
+        if (material_config.material_print_speed == slamsSlow)
+            layer_times += exposure_safe_delay_before;
+        else if (material_config.material_print_speed == slamsHighViscosity)
+            layer_times += exposure_high_viscosity_delay_before;
+        else if (!is_fast_layer)
+            layer_times += exposure_slow_move_delay_before;
+
+        // Increase layer time for "magic constants" from FW
+        layer_times += (
+            l_height * 5  // tower move
+            + 120 / 1000  // Magical constant to compensate remaining computation delay in exposure thread
+        );
+
+        layers_times.push_back(layer_times);
+        estim_time += layer_times;
+    }
 
     auto SCALING2 = SCALING_FACTOR * SCALING_FACTOR;
     print_statistics.support_used_material = supports_volume * SCALING2;
@@ -1152,6 +1183,13 @@ void SLAPrint::Steps::rasterize()
     // Print all the layers in parallel
     m_print->m_archiver->draw_layers(m_print->m_printer_input.size(), lvlfn,
                                     [this]() { return canceled(); }, ex_tbb);
+
+    auto &print_statistics = m_print->m_print_statistics;
+    print_statistics.encoded_layers_size  = m_print->m_archiver->encoded_layers_size();
+    print_statistics.layers_encoding_time = m_print->m_archiver->layers_encoding_time();
+    BOOST_LOG_TRIVIAL(info) << "Layer images encoded: "
+                            << print_statistics.encoded_layers_size / (1024. * 1024.) << " MB, "
+                            << print_statistics.layers_encoding_time << " s";
 }
 
 std::string SLAPrint::Steps::label(SLAPrintObjectStep step)
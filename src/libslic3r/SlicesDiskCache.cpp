@@ -0,0 +1,104 @@
+#include "SlicesDiskCache.hpp"
+#include "ExPolygonSerialize.hpp"
+#include "libslic3r_version.h"
+
+#include <boost/algorithm/hex.hpp>
+#include <boost/filesystem.hpp>
+#include <boost/log/trivial.hpp>
+#include <boost/nowide/fstream.hpp>
+//FIXME replace with <boost/md5.hpp> after it becomes mainstream, see AppConfig.cpp.
+#include <boost/uuid/detail/md5.hpp>
+
+#include <cereal/archives/binary.hpp>
+
+namespace Slic3r {
+
+// Bump if the slicing algorithm or the file layout changes within a single PrusaSlicer version.
+static constexpr uint32_t SLICES_CACHE_FORMAT = 1;
+static constexpr uint32_t SLICES_CACHE_MAGIC  = 0x534c4353; // "SLCS"
+
+std::string SlicesDiskCache::key(const indexed_triangle_set &its, const MeshSlicingParamsEx &params, const std::vector<float> &zs)
+{
+    using boost::uuids::detail::md5;
+    md5 hash;
+    auto process = [&hash](const auto &value) { hash.process_bytes(&value, sizeof(value)); };
+
+    const std::string version = std::string(SLIC3R_VERSION) + "/" + std::to_string(SLICES_CACHE_FORMAT);
+    hash.process_bytes(version.data(), version.size());
+
+    process(its.vertices.size());
+    process(its.indices.size());
+    hash.process_bytes(its.vertices.data(), its.vertices.size() * sizeof(stl_vertex));
+    hash.process_bytes(its.indices.data(), its.indices.size() * sizeof(stl_triangle_vertex_indices));
+
+    process(params.mode);
+    process(uint64_t(params.slicing_mode_normal_below_layer));
+    process(params.mode_below);
+    hash.process_bytes(params.trafo.matrix().data(), 16 * sizeof(double));
+    process(params.closing_radius);
+    process(params.extra_offset);
+    process(params.resolution);
+
+    process(zs.size());
+    hash.process_bytes(zs.data(), zs.size() * sizeof(float));
+
+    md5::digest_type digest{};
+    hash.get_digest(digest);
+    std::string out;
+    boost::algorithm::hex(digest, digest + std::size(digest), std::back_inserter(out));
+    return out;
+}
+
+static boost::filesystem::path slices_path(const std::string &dir, const std::string &key)
+{
+    return boost::filesystem::path(dir) / (key + ".slices");
+}
+
+bool SlicesDiskCache::load(const std::string &key, std::vector<ExPolygons> &slices) const
+{
+    const boost::filesystem::path path = slices_path(m_dir, key);
+    boost::system::error_code     ec;
+    if (! boost::filesystem::exists(path, ec))
+        return false;
+
+    try {
+        boost::nowide::ifstream ifs(path.string(), std::ios::binary);
+        cereal::BinaryInputArchive archive(ifs);
+        uint32_t magic = 0, format = 0;
+        archive(magic, format);
+        if (magic != SLICES_CACHE_MAGIC || format != SLICES_CACHE_FORMAT)
+            return false;
+        std::vector<ExPolygons> loaded;
+        archive(loaded);
+        slices = std::move(loaded);
+    } catch (const std::exception &ex) {
+        BOOST_LOG_TRIVIAL(warning) << "Failed to read cached slices " << path.string() << ": " << ex.what();
+        return false;
+    }
+    return true;
+}
+
+void SlicesDiskCache::store(const std::string &key, const std::vector<ExPolygons> &slices) const
+{
+    const boost::filesystem::path path = slices_path(m_dir, key);
+    // Write into a temporary file first, so that another process sharing the cache never reads a partially written file.
+    const boost::filesystem::path path_tmp = path.parent_path() / boost::filesystem::unique_path(key + "-%%%%%%%%.tmp");
+    try {
+        boost::filesystem::create_directories(path.parent_path());
+        boost::nowide::ofstream ofs(path_tmp.string(), std::ios::binary);
+        {
+            cereal::BinaryOutputArchive archive(ofs);
+            archive(SLICES_CACHE_MAGIC, SLICES_CACHE_FORMAT, slices);
+        }
+        ofs.close();
+        if (! ofs)
+            throw std::runtime_error("write failed");
+        boost::filesystem::rename(path_tmp, path);
+    } catch (const std::exception &ex) {
+        BOOST_LOG_TRIVIAL(warning) << "Failed to write cached slices " << path.string() << ": " << ex.what();
+        boost::system::error_code ec;
+        boost::filesystem::remove(path_tmp, ec);
+    }
+}
+
+} // namespace Slic3r
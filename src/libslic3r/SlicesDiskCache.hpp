@@ -0,0 +1,40 @@
+#ifndef slic3r_SlicesDiskCache_hpp_
+#define slic3r_SlicesDiskCache_hpp_
+
+#include <string>
+#include <vector>
+
+#include "ExPolygon.hpp"
+#include "TriangleMesh.hpp"
+#include "TriangleMeshSlicer.hpp"
+
+namespace Slic3r {
+
+// Content addressed store of the slices of ModelVolumes in a directory on disk, to be shared by the application sessions
+// and the command line runs slicing the same meshes with the same parameters over and over again.
+// The slices are addressed by a hash of the transformed mesh, of the slicing parameters and of the slicing Zs,
+// thus any change of the mesh or of the configuration options affecting the slices produces a different key.
+// Files written by another version of PrusaSlicer are never hit, the version is a part of the key.
+// The directory is not pruned.
+class SlicesDiskCache
+{
+public:
+    explicit SlicesDiskCache(const std::string &dir) : m_dir(dir) {}
+
+    const std::string& dir() const { return m_dir; }
+
+    // Hex encoded hash of the inputs of slice_mesh_ex().
+    static std::string key(const indexed_triangle_set &its, const MeshSlicingParamsEx &params, const std::vector<float> &zs);
+
+    // Returns false if the slices are not cached or the cache file could not be read.
+    bool load(const std::string &key, std::vector<ExPolygons> &slices) const;
+    // Failure to write the cache file is only logged.
+    void store(const std::string &key, const std::vector<ExPolygons> &slices) const;
+
+private:
+    std::string m_dir;
+};
+
+} // namespace Slic3r
+
+#endif // slic3r_SlicesDiskCache_hpp_
@@ -73,13 +73,27 @@ indexed_triangle_set slices_to_mesh(
         its_merge(layers[i], straight_walls(upper, grid[i], grid[i + 1]));
         }, threads_cnt);
 
-    auto merge_fn = []( const indexed_triangle_set &a, const indexed_triangle_set &b ) {
-        indexed_triangle_set res{a}; its_merge(res, b); return res;
-    };
+    // Concatenate the layers in parallel at precomputed offsets instead of
+    // copying the partial meshes over and over in a pairwise reduction.
+    std::vector<size_t> vertex_offs(layers.size() + 1, 0), face_offs(layers.size() + 1, 0);
+    for (size_t i = 0; i < layers.size(); ++i) {
+        vertex_offs[i + 1] = vertex_offs[i] + layers[i].vertices.size();
+        face_offs[i + 1]   = face_offs[i] + layers[i].indices.size();
+    }
 
-    auto ret = execution::reduce(ex_tbb, layers.begin(), layers.end(),
-                                 indexed_triangle_set{}, merge_fn,
-                                 threads_cnt);
+    indexed_triangle_set ret;
+    ret.vertices.resize(vertex_offs.back());
+    ret.indices.resize(face_offs.back());
+    execution::for_each(ex_tbb, size_t(0), layers.size(), [&layers, &ret, &vertex_offs, &face_offs](size_t i) {
+        indexed_triangle_set &layer = layers[i];
+        std::copy(layer.vertices.begin(), layer.vertices.end(), ret.vertices.begin() + vertex_offs[i]);
+        auto offs = int(vertex_offs[i]);
+        std::transform(layer.indices.begin(), layer.indices.end(), ret.indices.begin() + face_offs[i],
+                       [offs](const stl_triangle_vertex_indices &f) -> stl_triangle_vertex_indices {
+                           return f + stl_triangle_vertex_indices::Constant(offs);
+                       });
+        layer = {};
+        }, threads_cnt);
 
     its_merge(ret, triangulate_expolygons_3d(slices.front(), zmin, NORMALS_DOWN));
     its_merge(ret, straight_walls(slices.front(), zmin, grid.front()));
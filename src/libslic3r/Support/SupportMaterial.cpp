@@ -26,6 +26,7 @@
 
 #include <cmath>
 #include <memory>
+#include <mutex>
 #include <boost/log/trivial.hpp>
 #include <boost/container/static_vector.hpp>
 
@@ -111,11 +112,10 @@ static std::vector<unsigned char> rasterize_polygons(const Vec2i &grid_size, con
     agg::render_scanlines(rasterizer, scanline, renderer);
     return data;
 }
+// Trace the boundaries of the filled grid cells, return them in grid coordinates.
 // Grid has to have the boundary pixels unset.
-static Polygons contours_simplified(const Vec2i &grid_size, const double pixel_size, Point left_bottom, const std::vector<unsigned char> &grid, coord_t offset, bool fill_holes)
+static Polygons grid_contours(const Vec2i &grid_size, const std::vector<unsigned char> &grid, bool fill_holes)
 {
-    assert(std::abs(2 * offset) < pixel_size - 10);
-
     // Fill in empty cells, which have a left / right neighbor filled.
     // Fill in empty cells, which have the top / bottom neighbor filled.
     std::vector<unsigned char>        cell_inside_data;
@@ -206,8 +206,14 @@ static Polygons contours_simplified(const Vec2i &grid_size, const double pixel_s
     end_of_poly:
         out.push_back(std::move(poly));
     }
+    return out;
+}
+
+// Scale the contours traced by grid_contours() back into world, shrink them slightly by offset and remove collinear points.
+static Polygons contours_simplified(const double pixel_size, Point left_bottom, Polygons out, coord_t offset)
+{
+    assert(std::abs(2 * offset) < pixel_size - 10);
 
-    // 3) Scale the polygons back into world, shrink slightly and remove collinear points.
     for (Polygon &poly : out) {
         for (Point &p : poly.points) {
 #if 0
@@ -611,7 +617,7 @@ public:
         case smsGrid:
         {
     #ifdef SUPPORT_USE_AGG_RASTERIZER
-            Polygons support_polygons_simplified = contours_simplified(m_grid_size, m_pixel_size, m_bbox.min, m_grid2, offset_in_grid, fill_holes);
+            Polygons support_polygons_simplified = contours_simplified(m_pixel_size, m_bbox.min, this->traced_grid_contours(fill_holes), offset_in_grid);
     #else // SUPPORT_USE_AGG_RASTERIZER
             // Generate islands, so each island may be tested for overlap with island_samples.
             assert(std::abs(2 * offset_in_grid) < m_grid.resolution());
@@ -836,24 +842,37 @@ private:
     SupportGridPattern& operator=(const SupportGridPattern &rhs);
 
 #ifdef SUPPORT_USE_AGG_RASTERIZER
+    // Contours of m_grid2 in grid coordinates. Traced once per fill_holes value, then shared by all extract_support() calls,
+    // which may run in parallel and which only differ by the offset applied when converting the contours back to world.
+    const Polygons& traced_grid_contours(bool fill_holes)
+    {
+        std::call_once(m_grid_contours_once[fill_holes], [this, fill_holes]() { m_grid_contours[fill_holes] = grid_contours(m_grid_size, m_grid2, fill_holes); });
+        return m_grid_contours[fill_holes];
+    }
+
     // Dilate the trimming region (unmask the boundary pixels).
     static std::vector<unsigned char> dilate_trimming_region(const std::vector<unsigned char> &trimming, const Vec2i &grid_size)
     {
+        // 4-neighborhood is not sufficient, the 8-neighborhood is tested.
+        // The 3x3 neighborhood test is separable: AND of 3 horizontal neighbors first, then AND of 3 rows of the result.
+        // The inner loops are branchless to allow the compiler to vectorize them.
+        const int stride = grid_size.x();
+        std::vector<unsigned char> horizontal(trimming.size(), 0);
+        for (int r = 0; r < grid_size.y(); ++ r) {
+            const unsigned char *src = trimming.data() + r * stride;
+            unsigned char       *dst = horizontal.data() + r * stride;
+            for (int c = 1; c + 1 < grid_size.x(); ++ c)
+                dst[c] = (src[c - 1] != 0) & (src[c] != 0) & (src[c + 1] != 0);
+        }
         std::vector<unsigned char> dilated(trimming.size(), 0);
-        for (int r = 1; r + 1 < grid_size.y(); ++ r)
-            for (int c = 1; c + 1 < grid_size.x(); ++ c) {
-                //int addr = c + r * m_grid_size.x();
-                // 4-neighborhood is not sufficient.
-                // dilated[addr] = trimming[addr] != 0 && trimming[addr - 1] != 0 && trimming[addr + 1] != 0 && trimming[addr - m_grid_size.x()] != 0 && trimming[addr + m_grid_size.x()] != 0;
-                // 8-neighborhood
-                int addr = c + (r - 1) * grid_size.x();
-                bool b = trimming[addr - 1] != 0 && trimming[addr] != 0 && trimming[addr + 1] != 0;
-                addr += grid_size.x();
-                b = b && trimming[addr - 1] != 0 && trimming[addr] != 0 && trimming[addr + 1] != 0;
-                addr += grid_size.x();
-                b = b && trimming[addr - 1] != 0 && trimming[addr] != 0 && trimming[addr + 1] != 0;
-                dilated[addr - grid_size.x()] = b;
-            }
+        for (int r = 1; r + 1 < grid_size.y(); ++ r) {
+            const unsigned char *above = horizontal.data() + (r - 1) * stride;
+            const unsigned char *mid   = above + stride;
+            const unsigned char *below = mid + stride;
+            unsigned char       *dst   = dilated.data() + r * stride;
+            for (int c = 1; c + 1 < grid_size.x(); ++ c)
+                dst[c] = above[c] & mid[c] & below[c];
+        }
         return dilated;
     }
 
@@ -862,40 +881,43 @@ private:
     {
         int size      = oversampling;
         int stride    = grid_size.x();
-        for (int block_r = 0; block_r < grid_blocks.y(); ++ block_r)
-            for (int block_c = 0; block_c < grid_blocks.x(); ++ block_c) {
-                // Propagate the support pixels over the macro cell up to the trimming mask.
-                int                  addr      = block_c * size + 1 + (block_r * size + 1) * stride;
-                unsigned char       *grid_data = grid.data() + addr;
-                const unsigned char *mask_data = trimming.data() + addr;
-                // Top to bottom propagation.
-                #define PROPAGATION_STEP(offset) \
-                    do { \
-                        int addr = r * stride + c; \
-                        int addr2 = addr + offset; \
-                        if (grid_data[addr2] && ! mask_data[addr] && ! mask_data[addr2]) \
-                            grid_data[addr] = 1; \
-                    } while (0);
-                for (int r = 0; r < size; ++ r) {
-                    if (r > 0)
+        // Each block is filled independently of the other blocks.
+        tbb::parallel_for(tbb::blocked_range<int>(0, grid_blocks.y()), [&grid, &trimming, &grid_blocks, size, stride](const tbb::blocked_range<int> &range) {
+            for (int block_r = range.begin(); block_r < range.end(); ++ block_r)
+                for (int block_c = 0; block_c < grid_blocks.x(); ++ block_c) {
+                    // Propagate the support pixels over the macro cell up to the trimming mask.
+                    int                  addr      = block_c * size + 1 + (block_r * size + 1) * stride;
+                    unsigned char       *grid_data = grid.data() + addr;
+                    const unsigned char *mask_data = trimming.data() + addr;
+                    // Top to bottom propagation.
+                    #define PROPAGATION_STEP(offset) \
+                        do { \
+                            int addr = r * stride + c; \
+                            int addr2 = addr + offset; \
+                            if (grid_data[addr2] && ! mask_data[addr] && ! mask_data[addr2]) \
+                                grid_data[addr] = 1; \
+                        } while (0);
+                    for (int r = 0; r < size; ++ r) {
+                        if (r > 0)
+                            for (int c = 0; c < size; ++ c)
+                                PROPAGATION_STEP(- stride);
+                        for (int c = 1; c < size; ++ c)
+                            PROPAGATION_STEP(- 1);
+                        for (int c = size - 2; c >= 0; -- c)
+                            PROPAGATION_STEP(+ 1);
+                    }
+                    // Bottom to top propagation.
+                    for (int r = size - 2; r >= 0; -- r) {
                         for (int c = 0; c < size; ++ c)
-                            PROPAGATION_STEP(- stride);
-                    for (int c = 1; c < size; ++ c)
-                        PROPAGATION_STEP(- 1);
-                    for (int c = size - 2; c >= 0; -- c)
-                        PROPAGATION_STEP(+ 1);
-                }
-                // Bottom to top propagation.
-                for (int r = size - 2; r >= 0; -- r) {
-                    for (int c = 0; c < size; ++ c)
-                        PROPAGATION_STEP(+ stride);
-                    for (int c = 1; c < size; ++ c)
-                        PROPAGATION_STEP(- 1);
-                    for (int c = size - 2; c >= 0; -- c)
-                        PROPAGATION_STEP(+ 1);
+                            PROPAGATION_STEP(+ stride);
+                        for (int c = 1; c < size; ++ c)
+                            PROPAGATION_STEP(- 1);
+                        for (int c = size - 2; c >= 0; -- c)
+                            PROPAGATION_STEP(+ 1);
+                    }
+                    #undef PROPAGATION_STEP
                 }
-                #undef PROPAGATION_STEP
-            }
+        });
     }
 #endif // SUPPORT_USE_AGG_RASTERIZER
 
@@ -972,6 +994,9 @@ private:
     double                      m_pixel_size;
     BoundingBox                 m_bbox;
     std::vector<unsigned char>  m_grid2;
+    // Cached by traced_grid_contours(), indexed by fill_holes.
+    std::once_flag              m_grid_contours_once[2];
+    Polygons                    m_grid_contours[2];
 #else // SUPPORT_USE_AGG_RASTERIZER
     Slic3r::EdgeGrid::Grid      m_grid;
 #endif // SUPPORT_USE_AGG_RASTERIZER
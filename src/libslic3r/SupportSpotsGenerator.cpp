@@ -1169,7 +1169,9 @@ void estimate_supports_malformations(SupportLayerPtrs &layers, float flow_width,
         l->curled_lines.clear();
         std::vector<ExtrusionLine> current_layer_lines;
 
-        for (const ExtrusionEntity *extrusion : l->support_fills.flatten().entities) {
+        std::vector<const ExtrusionEntity*> support_extrusions;
+        l->support_fills.collect_leaves(support_extrusions);
+        for (const ExtrusionEntity *extrusion : support_extrusions) {
             Polyline pl = extrusion->as_polyline();
             Polygon  pol(pl.points);
             pol.make_counter_clockwise();
@@ -1242,8 +1244,11 @@ void estimate_malformations(LayerPtrs &layers, const Params &params)
         std::vector<Linef> boundary_lines = l->lower_layer != nullptr ? to_unscaled_linesf(l->lower_layer->lslices) : std::vector<Linef>();
         AABBTreeLines::LinesDistancer<Linef> prev_layer_boundary{std::move(boundary_lines)};
         std::vector<ExtrusionLine>           current_layer_lines;
+        std::vector<const ExtrusionEntity*> perimeters;
         for (const LayerRegion *layer_region : l->regions()) {
-            for (const ExtrusionEntity *extrusion : layer_region->perimeters().flatten().entities) {
+            perimeters.clear();
+            layer_region->perimeters().collect_leaves(perimeters);
+            for (const ExtrusionEntity *extrusion : perimeters) {
                 if (!extrusion->role().is_external_perimeter())
                     continue;
 
@@ -1558,6 +1558,15 @@ float its_volume(const indexed_triangle_set &its)
     return volume;
 }
 
+float its_area(const indexed_triangle_set &its)
+{
+    float area = 0.f;
+    for (size_t i = 0; i < its.indices.size(); ++ i)
+        area += its_unnormalized_normal(its, i).norm();
+
+    return 0.5f * area;
+}
+
 float its_average_edge_length(const indexed_triangle_set &its)
 {
     if (its.indices.empty())
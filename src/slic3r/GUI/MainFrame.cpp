@@ -955,7 +955,7 @@ bool MainFrame::can_export_supports() const
     const PrintObjects& objects = m_plater->sla_print().objects();
     for (const SLAPrintObject* object : objects)
     {
-        if (!object->support_mesh().empty() || !object->pad_mesh().empty())
+        if (object->has_support_tree() || !object->pad_mesh().empty())
         {
             can_export = true;
             break;
@@ -2162,6 +2162,11 @@ Plater::priv::priv(Plater *q, MainFrame *main_frame)
     , collapse_toolbar(GLToolbar::Normal, "Collapse")
     , m_project_filename(wxEmptyString)
 {
+    // Slices cache shared with the previous sessions and the command line, see Print::set_slices_cache_dir().
+    fff_print.set_slices_cache_dir(wxGetApp().app_config->get("slices_cache_dir"));
+    // Retain the slices for re-slicing, mesh the SLA supports in the background to be displayed.
+    fff_print.set_interactive(true);
+    sla_print.set_interactive(true);
     background_process.set_fff_print(&fff_print);
     background_process.set_sla_print(&sla_print);
     background_process.set_gcode_result(&gcode_result);
@@ -5486,6 +5486,7 @@ void TabSLAPrint::build()
     optgroup->append_single_option_line("hollowing_min_thickness");
     optgroup->append_single_option_line("hollowing_quality");
     optgroup->append_single_option_line("hollowing_closing_distance");
+    optgroup->append_single_option_line("hollowing_max_memory");
 
     page = add_options_page(L("Advanced"), "wrench");
     optgroup = page->new_optgroup(L("Slicing"));
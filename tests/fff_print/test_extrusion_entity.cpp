@@ -315,6 +315,15 @@ SCENARIO("ExtrusionEntityCollection: Polygon flattening", "[ExtrusionEntity]")
             THEN("The output EEC contains no Extrusion Entity Collections") {
                 CHECK(std::count_if(output.entities.cbegin(), output.entities.cend(), [=](const ExtrusionEntity* e) {return e->is_collection();}) == 0);
             }
+            AND_THEN("The leaves of the EEC are the flattened entities in the same order") {
+                std::vector<const ExtrusionEntity*> leaves;
+                sample.collect_leaves(leaves);
+                REQUIRE(leaves.size() == output.entities.size());
+                for (size_t i = 0; i < leaves.size(); ++ i) {
+                    CHECK(leaves[i]->first_point() == output.entities[i]->first_point());
+                    CHECK(leaves[i]->last_point() == output.entities[i]->last_point());
+                }
+            }
         }
         WHEN("The EEC is flattened with preservation (preserve_order=true)") {
 			output = sample.flatten(true);
@@ -7,6 +7,7 @@
 
 #include "libslic3r/ClipperUtils.hpp"
 #include "libslic3r/Fill/Fill.hpp"
+#include "libslic3r/Fill/FillPlanePath.hpp"
 #include "libslic3r/Flow.hpp"
 #include "libslic3r/Layer.hpp"
 #include "libslic3r/Geometry.hpp"
@@ -198,6 +199,37 @@ TEST_CASE("Fill: Pattern Path Length", "[Fill]") {
     }
 }
 
+TEST_CASE("Fill: Plane path curves shared between layers", "[Fill]") {
+    // Sparse plane path infill aligned to the object's bounding box, clipped by two different surfaces.
+    const ExPolygon square { Point::new_scale(10, 10), Point::new_scale(40, 10), Point::new_scale(40, 40), Point::new_scale(10, 40) };
+    const ExPolygon triangle { Point::new_scale(5, 5), Point::new_scale(45, 5), Point::new_scale(25, 45) };
+    const BoundingBox bbox { Point::new_scale(0, 0), Point::new_scale(50, 50) };
+    for (const char *pattern : { "archimedeanchords", "hilbertcurve", "octagramspiral" }) {
+        SECTION(pattern) {
+            auto fill = [&bbox, pattern](const ExPolygon &expolygon, PlanePathCurves *curves) {
+                std::unique_ptr<Slic3r::Fill> filler(Slic3r::Fill::new_from_type(pattern));
+                dynamic_cast<FillPlanePath*>(filler.get())->curves = curves;
+                filler->set_bounding_box(bbox);
+                filler->spacing = 0.45;
+                FillParams fill_params;
+                fill_params.density           = 0.2f;
+                fill_params.anchor_length_max = 0.f;
+                Slic3r::Surface surface(stInternal, expolygon);
+                return filler->fill_surface(&surface, fill_params);
+            };
+            const Polylines square_paths   = fill(square, nullptr);
+            const Polylines triangle_paths = fill(triangle, nullptr);
+            REQUIRE(! square_paths.empty());
+            REQUIRE(! triangle_paths.empty());
+            PlanePathCurves curves;
+            // The curve is generated and cached by the first call, then reused. The output is identical to the uncached one.
+            CHECK(fill(square, &curves) == square_paths);
+            CHECK(fill(triangle, &curves) == triangle_paths);
+            CHECK(fill(square, &curves) == square_paths);
+        }
+    }
+}
+
 SCENARIO("Infill does not exceed perimeters", "[Fill]") 
 {
     auto test = [](const std::string_view pattern) {
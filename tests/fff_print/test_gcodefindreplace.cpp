@@ -96,6 +96,35 @@ SCENARIO("Find/Replace with plain text", "[GCodeFindReplace]") {
             GCodeFindReplace find_replace({ "move up\\nG1 X", "move down\\nG0 X", "w", "" });
             REQUIRE(find_replace.process_layer(gcode) == gcode);
         }
+
+        // Multiple substitutions
+        WHEN("Independent plain substitutions are applied") {
+            GCodeFindReplace find_replace({ "home", "park", "", "", "infill", "sparse", "", "", "wipe", "retract", "", "" });
+            REQUIRE(find_replace.process_layer(gcode) ==
+                "G1 Z0; park\n"
+                "G1 Z1; move up\n"
+                "G1 X0 Y1 Z1; perimeter\n"
+                "G1 X13 Y32 Z1; sparse\n"
+                "G1 X13 Y32 Z1; retract\n");
+        }
+        WHEN("Substitution matches the output of the previous substitution") {
+            GCodeFindReplace find_replace({ "home", "move up", "", "", "move up", "move down", "", "" });
+            REQUIRE(find_replace.process_layer(gcode) ==
+                "G1 Z0; move down\n"
+                "G1 Z1; move down\n"
+                "G1 X0 Y1 Z1; perimeter\n"
+                "G1 X13 Y32 Z1; infill\n"
+                "G1 X13 Y32 Z1; wipe\n");
+        }
+        WHEN("Overlapping patterns are applied in order") {
+            GCodeFindReplace find_replace({ "Y32 Z1", "Y30 Z1", "", "", "X13 Y32", "X10 Y32", "", "" });
+            REQUIRE(find_replace.process_layer(gcode) ==
+                "G1 Z0; home\n"
+                "G1 Z1; move up\n"
+                "G1 X0 Y1 Z1; perimeter\n"
+                "G1 X13 Y30 Z1; infill\n"
+                "G1 X13 Y30 Z1; wipe\n");
+        }
     }
 
     GIVEN("G-code with decimals") {
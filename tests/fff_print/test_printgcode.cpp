@@ -2,6 +2,7 @@
 
 #include "libslic3r/libslic3r.h"
 #include "libslic3r/GCodeReader.hpp"
+#include "libslic3r/ModelArrange.hpp"
 
 #include "test_data.hpp"
 
@@ -269,3 +270,48 @@ SCENARIO( "PrintGCode basic functionality", "[PrintGCode]") {
         }
     }
 }
+
+SCENARIO("PrintGCode releasing the exported layers", "[PrintGCode]") {
+    GIVEN("A cube with two instances printed sequentially") {
+        DynamicPrintConfig config = DynamicPrintConfig::full_print_config();
+        config.set_deserialize_strict({
+            { "complete_objects",   true },
+            { "layer_height",       0.2 },
+            { "first_layer_height", 0.2 },
+            { "skirts",             0 },
+            { "retract_lift",       0 }
+        });
+        Slic3r::Print print;
+        Slic3r::Model model;
+        Slic3r::Test::init_print({ TestMesh::cube_20x20x20 }, print, model, config);
+        model.objects.front()->add_instance();
+        arrange_objects(model, arr2::to_arrange_bed(get_bed_shape(config)), arr2::ArrangeSettings{}.set_distance_from_objects(min_object_distance(config)));
+        model.center_instances_around_point({ 100, 100 });
+        print.apply(model, config);
+        REQUIRE(print.objects().size() == 1);
+        REQUIRE(print.objects().front()->instances().size() == 2);
+        WHEN("the layers are released after export") {
+            print.set_release_layers_after_export(true);
+            std::string gcode = Slic3r::Test::gcode(print);
+            THEN("both copies are extruded the same") {
+                // Number of extrusion moves of the first and of the second copy, the Z drops when the second copy starts.
+                std::vector<size_t> extrusions(1, 0);
+                double max_z = 0.;
+                GCodeReader reader;
+                reader.apply_config(print.config());
+                reader.parse_buffer(gcode, [&extrusions, &max_z](GCodeReader &self, const GCodeReader::GCodeLine &line) {
+                    if (line.has_z()) {
+                        if (line.z() < max_z - EPSILON && extrusions.size() == 1)
+                            extrusions.emplace_back(0);
+                        max_z = std::max(max_z, double(line.z()));
+                    }
+                    if (line.extruding(self) && line.dist_XY(self) > 0)
+                        ++ extrusions.back();
+                });
+                REQUIRE(extrusions.size() == 2);
+                REQUIRE(extrusions.front() > 0);
+                REQUIRE(extrusions.front() == extrusions.back());
+            }
+        }
+    }
+}
@@ -6,6 +6,8 @@
 
 #include "test_data.hpp"
 
+#include <boost/filesystem.hpp>
+
 using namespace Slic3r;
 using namespace Slic3r::Test;
 
@@ -87,3 +89,149 @@ SCENARIO("PrintObject: object layer heights", "[PrintObject]") {
 #endif
     }
 }
+
+SCENARIO("PrintObject: re-slicing an unchanged volume", "[PrintObject]") {
+    GIVEN("20mm cube sliced by an interactive and by a command line Print") {
+        Slic3r::DynamicPrintConfig config = Slic3r::DynamicPrintConfig::full_print_config();
+        auto reslice = [&config](bool interactive) {
+            Slic3r::Print print;
+            Slic3r::Model model;
+            print.set_interactive(interactive);
+            Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, config);
+            print.process();
+            REQUIRE(print.objects().front()->num_reused_volume_slices() == 0);
+            // Invalidates posSlice, but not the slicing of the ModelVolume.
+            Slic3r::DynamicPrintConfig config2 = config;
+            config2.set("elefant_foot_compensation", 0.3);
+            print.apply(model, config2);
+            REQUIRE(! print.objects().front()->is_step_done(posSlice));
+            print.process();
+            return print.objects().front()->num_reused_volume_slices();
+        };
+        WHEN("the elephant foot compensation is changed") {
+            THEN("the interactive Print reuses the slices of the cube") {
+                REQUIRE(reslice(true) == 1);
+            }
+            THEN("the command line Print does not retain the slices") {
+                REQUIRE(reslice(false) == 0);
+            }
+        }
+    }
+}
+
+SCENARIO("PrintObject: adding and moving a modifier", "[PrintObject]") {
+    GIVEN("20mm cube sliced by an interactive Print") {
+        Slic3r::DynamicPrintConfig config = Slic3r::DynamicPrintConfig::full_print_config();
+        Slic3r::Print print;
+        Slic3r::Model model;
+        print.set_interactive(true);
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, config);
+        print.process();
+        REQUIRE(print.objects().front()->num_reused_volume_slices() == 0);
+        WHEN("a modifier is added inside the cube") {
+            // Adding a modifier recreates the PrintObject.
+            ModelVolume *modifier = model.objects.front()->add_volume(mesh(TestMesh::cube_20x20x20, Vec3d::Zero(), 0.25), ModelVolumeType::PARAMETER_MODIFIER);
+            modifier->config.set_deserialize_strict("fill_density", "100%");
+            modifier->set_offset(Vec3d(5., 5., 5.));
+            print.apply(model, config);
+            print.process();
+            THEN("the slices of the cube are reused, the modifier is sliced") {
+                REQUIRE(print.objects().front()->num_reused_volume_slices() == 1);
+            }
+            AND_WHEN("the modifier is moved and moved back") {
+                modifier->set_offset(Vec3d(8., 8., 8.));
+                print.apply(model, config);
+                print.process();
+                const size_t num_reused_moved = print.objects().front()->num_reused_volume_slices();
+                modifier->set_offset(Vec3d(5., 5., 5.));
+                print.apply(model, config);
+                print.process();
+                THEN("only the moved modifier is sliced again") {
+                    REQUIRE(num_reused_moved == 1);
+                }
+                THEN("the slices of both the cube and the modifier at its original position are reused") {
+                    REQUIRE(print.objects().front()->num_reused_volume_slices() == 2);
+                }
+            }
+        }
+    }
+}
+
+SCENARIO("PrintObject: reverting the layer height", "[PrintObject]") {
+    GIVEN("20mm cube sliced with 0.25mm layers") {
+        Slic3r::DynamicPrintConfig config = Slic3r::DynamicPrintConfig::full_print_config();
+        config.set_deserialize_strict({
+            { "layer_height",       0.25 },
+            { "first_layer_height", 0.25 }
+        });
+        Slic3r::Print print;
+        Slic3r::Model model;
+        // Only an interactive Print retains the slices of the previous slicings.
+        print.set_interactive(true);
+        Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, config);
+        print.process();
+        auto layer_areas = [&print]() {
+            std::vector<double> out;
+            for (const Layer *layer : print.objects().front()->layers())
+                out.emplace_back(area(layer->lslices));
+            return out;
+        };
+        std::vector<double> areas = layer_areas();
+        WHEN("the layer height is changed to 0.3mm and back to 0.25mm") {
+            config.set("layer_height", 0.3);
+            print.apply(model, config);
+            print.process();
+            REQUIRE(print.objects().front()->layers().size() != areas.size());
+            REQUIRE(print.objects().front()->num_reused_volume_slices() == 0);
+            config.set("layer_height", 0.25);
+            print.apply(model, config);
+            print.process();
+            THEN("the slices of the first slicing are reused") {
+                REQUIRE(print.objects().front()->num_reused_volume_slices() == 1);
+            }
+            THEN("the layers are the same as the ones sliced first") {
+                std::vector<double> areas2 = layer_areas();
+                REQUIRE(areas2.size() == areas.size());
+                for (size_t i = 0; i < areas.size(); ++ i)
+                    REQUIRE(areas2[i] == Approx(areas[i]));
+            }
+        }
+    }
+}
+
+SCENARIO("PrintObject: slices disk cache", "[PrintObject]") {
+    GIVEN("20mm cube and a slices cache directory") {
+        const boost::filesystem::path cache_dir = boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("slices-cache-%%%%-%%%%");
+        Slic3r::DynamicPrintConfig config = Slic3r::DynamicPrintConfig::full_print_config();
+        // Returns the areas of the layers and the number of volumes loaded from the disk cache.
+        auto slice = [&config, &cache_dir]() {
+            Slic3r::Print print;
+            Slic3r::Model model;
+            print.set_slices_cache_dir(cache_dir.string());
+            Slic3r::Test::init_print({TestMesh::cube_20x20x20}, print, model, config);
+            print.process();
+            std::vector<double> out;
+            for (const Layer *layer : print.objects().front()->layers())
+                out.emplace_back(area(layer->lslices));
+            return std::make_pair(out, print.objects().front()->num_loaded_volume_slices());
+        };
+        WHEN("the cube is sliced by two Prints") {
+            auto [areas, num_loaded] = slice();
+            REQUIRE(num_loaded == 0);
+            REQUIRE(std::distance(boost::filesystem::directory_iterator(cache_dir), boost::filesystem::directory_iterator()) == 1);
+            const boost::filesystem::path cache_file = boost::filesystem::directory_iterator(cache_dir)->path();
+            const std::time_t             mtime      = boost::filesystem::last_write_time(cache_file);
+            auto [areas2, num_loaded2] = slice();
+            THEN("the slices are stored once and the second Print loads the same slices") {
+                REQUIRE(num_loaded2 == 1);
+                REQUIRE(std::distance(boost::filesystem::directory_iterator(cache_dir), boost::filesystem::directory_iterator()) == 1);
+                // Not written again by the second Print.
+                REQUIRE(boost::filesystem::last_write_time(cache_file) == mtime);
+                REQUIRE(areas2.size() == areas.size());
+                for (size_t i = 0; i < areas.size(); ++ i)
+                    REQUIRE(areas2[i] == Approx(areas[i]));
+            }
+        }
+        boost::filesystem::remove_all(cache_dir);
+    }
+}
@@ -5,6 +5,7 @@
 #include <libslic3r/TriangleMesh.hpp>
 #include <libslic3r/AABBTreeIndirect.hpp>
 #include <libslic3r/AABBTreeLines.hpp>
+#include <libslic3r/EdgeGrid.hpp>
 
 using namespace Slic3r;
 
@@ -107,6 +108,39 @@ TEST_CASE("Creating a several 2d lines, testing all lines in radius query", "[AA
     REQUIRE(indices.size() == 3);
 }
 
+TEST_CASE("LinesDistancer query with a hint line matches the query without a hint", "[AABBIndirect]")
+{
+    // A convex polygon, the points are placed on the normals of its edges, thus each point has a single nearest line.
+    Polygon polygon;
+    for (size_t i = 0; i < 64; ++ i)
+        polygon.points.emplace_back(Point::new_scale(10. * cos(2. * PI * double(i) / 64.), 10. * sin(2. * PI * double(i) / 64.)));
+    const Lines lines = polygon.lines();
+    const AABBTreeLines::LinesDistancer<Line> distancer(lines);
+
+    for (size_t line_idx = 0; line_idx < lines.size(); ++ line_idx) {
+        const Line  &line   = lines[line_idx];
+        const Vec2d  normal = perp(line.vector().cast<double>()).normalized();
+        for (double offset : { -1., 1. }) {
+            const Point pt = line.midpoint() + (scaled(offset) * normal).cast<coord_t>();
+            const auto [dist, nearest_line, nearest_point]             = distancer.distance_from_lines_extra<false>(pt);
+            const auto [signed_dist, signed_line, signed_nearest_point] = distancer.distance_from_lines_extra<true>(pt);
+            REQUIRE(nearest_line == line_idx);
+            REQUIRE(signed_dist == (offset > 0. ? -dist : dist));
+            // The nearest line, a neighbor line, the opposite line and an invalid hint.
+            for (size_t hint : { line_idx, (line_idx + 1) % lines.size(), (line_idx + lines.size() / 2) % lines.size(), size_t(-1) }) {
+                const auto [hint_dist, hint_line, hint_point] = distancer.distance_from_lines_extra<false>(pt, hint);
+                REQUIRE(hint_dist == dist);
+                REQUIRE(hint_line == nearest_line);
+                REQUIRE(hint_point == nearest_point);
+                const auto [hint_signed_dist, hint_signed_line, hint_signed_point] = distancer.distance_from_lines_extra<true>(pt, hint);
+                REQUIRE(hint_signed_dist == signed_dist);
+                REQUIRE(hint_signed_line == signed_line);
+                REQUIRE(hint_signed_point == signed_nearest_point);
+            }
+        }
+    }
+}
+
 TEST_CASE("Find the closest point from ExPolys", "[ClosestPoint]") {
     //////////////////////////////
     //  0 - 3
@@ -407,3 +441,44 @@ TEST_CASE("AABBTreeLines vs SignedDistanceGrid time Benchmark", "[AABBIndirect]"
 }
 #endif
 
+
+TEST_CASE("EdgeGrid batched closest point query matches the single point query", "[EdgeGrid]")
+{
+    ExPolygon expoly;
+    expoly.contour = Polygon::new_scale({ { 0., 0. }, { 20., 0. }, { 20., 20. }, { 0., 20. } });
+    Polygon hole = Polygon::new_scale({ { 5., 5. }, { 15., 5. }, { 15., 15. }, { 5., 15. } });
+    hole.reverse();
+    expoly.holes.emplace_back(std::move(hole));
+
+    EdgeGrid::Grid grid;
+    grid.create(expoly, scaled<coord_t>(1.));
+
+    // Query points inside, outside and on the boundary of the ExPolygon, including points outside of the grid,
+    // in an order not following the grid cells.
+    Points pts;
+    for (int i = 0; i < 2000; ++ i)
+        pts.emplace_back(scaled<coord_t>(-2. + double((i * 7919) % 2000) * 0.012), scaled<coord_t>(-2. + double((i * 104729) % 2000) * 0.012));
+    for (const Point &pt : expoly.contour.points)
+        pts.emplace_back(pt);
+
+    const coord_t search_radius = scaled<coord_t>(1.5);
+    std::vector<EdgeGrid::Grid::ClosestPointResult> batched;
+    grid.closest_point_signed_distance(pts, search_radius, batched);
+    REQUIRE(batched.size() == pts.size());
+
+    size_t num_valid = 0;
+    for (size_t i = 0; i < pts.size(); ++ i) {
+        EdgeGrid::Grid::ClosestPointResult single = grid.closest_point_signed_distance(pts[i], search_radius);
+        REQUIRE(batched[i].valid() == single.valid());
+        if (single.valid()) {
+            ++ num_valid;
+            REQUIRE(batched[i].contour_idx == single.contour_idx);
+            REQUIRE(batched[i].start_point_idx == single.start_point_idx);
+            REQUIRE(batched[i].distance == single.distance);
+            REQUIRE(batched[i].t == single.t);
+        }
+    }
+    // Both points close to and far from the contours were queried.
+    REQUIRE(num_valid > 0);
+    REQUIRE(num_valid < pts.size());
+}
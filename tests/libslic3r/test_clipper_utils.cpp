@@ -382,3 +382,42 @@ TEST_CASE("Traversing Clipper PolyTree", "[ClipperUtils]") {
         REQUIRE(count_polys(output) == reference.size());
     }
 }
+
+TEST_CASE("Reusing the thread local Clipper engine", "[ClipperUtils]") {
+    Polygon square1 = Polygon::new_scale({ { 0., 0. }, { 10., 0. }, { 10., 10. }, { 0., 10. } });
+    Polygon square2 = square1;
+    square2.translate(scaled<coord_t>(5.), 0);
+    const double area_union = union_(Polygons{ square1, square2 }).front().area();
+    REQUIRE(area_union == Approx(scaled<double>(15.) * scaled<double>(10.)));
+
+    ClipperLib::Clipper *retained = nullptr;
+    {
+        ClipperUtils::ThreadLocalEngine<ClipperLib::Clipper> outer;
+        REQUIRE(outer.thread_local_engine());
+        retained = &*outer;
+        // Options set by the current user of the engine shall not leak into operations nested into it.
+        outer->ReverseSolution(true);
+        outer->StrictlySimple(true);
+        SECTION("Nested engine falls back to a temporary engine") {
+            ClipperUtils::ThreadLocalEngine<ClipperLib::Clipper> inner;
+            REQUIRE(! inner.thread_local_engine());
+            REQUIRE(&*inner != retained);
+            REQUIRE(! inner->ReverseSolution());
+        }
+        SECTION("Boolean executed while the engine is busy") {
+            Polygons out = union_(Polygons{ square1, square2 });
+            REQUIRE(out.size() == 1);
+            REQUIRE(out.front().area() == Approx(area_union));
+            ExPolygons expolys = offset_ex(out, scaled<float>(1.));
+            REQUIRE(expolys.size() == 1);
+            REQUIRE(expolys.front().contour.is_counter_clockwise());
+        }
+    }
+
+    ClipperUtils::ThreadLocalEngine<ClipperLib::Clipper> reused;
+    REQUIRE(reused.thread_local_engine());
+    REQUIRE(&*reused == retained);
+    // The options were reset when the engine was released.
+    REQUIRE(! reused->ReverseSolution());
+    REQUIRE(! reused->StrictlySimple());
+}
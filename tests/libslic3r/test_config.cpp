@@ -204,6 +204,29 @@ SCENARIO("Config accessor functions perform as expected.", "[Config]") {
     }
 }
 
+SCENARIO("Static config diff", "[Config]") {
+    GIVEN("Two PrintObjectConfig and a DynamicPrintConfig differing in two options") {
+        PrintObjectConfig config1;
+        PrintObjectConfig config2;
+        DynamicPrintConfig config3 = DynamicPrintConfig::full_print_config();
+        config2.set_deserialize_strict({ { "layer_height", "0.123" }, { "support_material", "1" } });
+        config3.set_deserialize_strict({ { "layer_height", "0.123" }, { "support_material", "1" } });
+        t_config_option_keys expected { "layer_height", "support_material" };
+        THEN("Diff of two static configs reports the changed options") {
+            REQUIRE(config1.diff(config2) == expected);
+            REQUIRE(config1.diff(config2) == static_cast<const ConfigBase&>(config1).diff(config2));
+        }
+        THEN("Diff of a static and a dynamic config reports the changed options") {
+            REQUIRE(config1.diff(config3) == expected);
+            REQUIRE(config1.diff(config3) == static_cast<const ConfigBase&>(config1).diff(config3));
+        }
+        THEN("Equal configs have an empty diff") {
+            REQUIRE(config2.diff(config2).empty());
+            REQUIRE(config2.diff(config3).empty());
+        }
+    }
+}
+
 SCENARIO("Config ini load/save interface", "[Config]") {
     WHEN("new_from_ini is called") {
 		Slic3r::DynamicPrintConfig config;
@@ -19,3 +19,26 @@ TEST_CASE("Hollow two overlapping spheres") {
     sphere1.WriteOBJFile("twospheres.obj");
 }
 
+
+TEST_CASE("Hollowing voxel scale fits into the memory limit") {
+    using namespace Slic3r;
+
+    indexed_triangle_set sphere = its_make_sphere(50., 2 * PI / 40.);
+    double volume = its_volume(sphere), area = its_area(sphere);
+
+    sla::HollowingConfig cfg;
+    cfg.quality = 1.;
+
+    double unlimited = sla::get_voxel_scale(volume, area, cfg);
+    REQUIRE(unlimited == Approx(sla::get_voxel_scale(volume, cfg)));
+
+    cfg.max_memory_mb = sla::estimate_hollowing_memory(area, unlimited, cfg) / (4. * 1024. * 1024.);
+    double limited = sla::get_voxel_scale(volume, area, cfg);
+
+    REQUIRE(limited < unlimited);
+    REQUIRE(sla::estimate_hollowing_memory(area, limited, cfg) <= cfg.max_memory_mb * 1024. * 1024.);
+
+    auto interior = sla::generate_interior(sphere, cfg);
+    REQUIRE(interior);
+    REQUIRE(sla::get_peak_memory(*interior) > 0);
+}
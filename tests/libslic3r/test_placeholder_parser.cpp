@@ -303,4 +303,17 @@ SCENARIO("Placeholder parser variables", "[PlaceholderParser]") {
         REQUIRE(parser.process(script, 0, nullptr, nullptr, nullptr) == "6");
     }
     SECTION("if else completely empty") { REQUIRE(parser.process("{if false then elsif false then else endif}", 0, nullptr, nullptr, nullptr) == ""); }
+
+    // Compiled templates have to produce the same output as templates processed at once.
+    auto compiled = [&parser](const std::string &templ) { return parser.process(PlaceholderParser::compile(templ), 0, nullptr, nullptr, nullptr); };
+    SECTION("compiled: plain text") { REQUIRE(compiled("G1 Z10\n;plain text } ]\n") == "G1 Z10\n;plain text } ]\n"); }
+    SECTION("compiled: empty template") { REQUIRE(compiled("") == ""); }
+    SECTION("compiled: text and macros") { REQUIRE(compiled("M104 S[temperature_[foo]] ; {temperature[foo] + bar}\n") == "M104 S357 ; 359\n"); }
+    SECTION("compiled: local variable shared between blocks") { REQUIRE(compiled("{local myint = 33+2} x {myint}") == " x 35"); }
+    SECTION("compiled: if spanning multiple blocks") { REQUIRE(compiled("a{if foo == 0}b{elsif bar}c{else}d{endif}e") == "abe"); }
+    SECTION("compiled: if inside a single block") { REQUIRE(compiled("a{if foo == 1 then \"b\" else \"c\" endif}d") == "acd"); }
+    SECTION("compiled: braces in string literals and regular expressions") {
+        REQUIRE(compiled("{\"}{\"}x{\"a}\" =~ /.*\\}.*/}") == "}{xtrue");
+    }
+    SECTION("compiled: syntax error is reported") { REQUIRE_THROWS_AS(compiled("ok\n{1 +* 3}"), std::runtime_error); }
 }
@@ -34,6 +34,11 @@ TEST_CASE("Archive export test", "[sla_archives]") {
         print.apply(m, cfg);
         print.process();
 
+        // The encoded size of the layers is reported by the print statistics.
+        DynamicConfig stats = print.print_statistics().config();
+        REQUIRE(stats.opt_float("encoded_layers_size") > 0.);
+        REQUIRE(stats.has("layers_encoding_time"));
+
         ThumbnailsList thumbnails;
         auto outputfname = std::string("output_") + pname + "." + entry.ext;
 
@@ -6,7 +6,11 @@
 #include "sla_test_utils.hpp"
 
 #include <libslic3r/TriangleMeshSlicer.hpp>
+#include <libslic3r/PNGReadWrite.hpp>
+#include <miniz.h>
 #include <libslic3r/SLA/SupportTreeMesher.hpp>
+#include <libslic3r/SLA/SupportTreeSlicer.hpp>
+#include <libslic3r/SLA/ScanlineRaster.hpp>
 #include <libslic3r/BranchingTree/PointCloud.hpp>
 
 namespace {
@@ -252,6 +256,63 @@ TEST_CASE("RasterizedPolygonAreaShouldMatch", "[SLARasterOutput]") {
 }
 
 
+TEST_CASE("Scanline raster matches the thresholded AA raster", "[SLARasterOutput]") {
+    double disp_w = 120., disp_h = 68.;
+    sla::Resolution res{2560, 1440};
+    sla::PixelDim pixdim{disp_w / res.width_px, disp_h / res.height_px};
+    auto bb = BoundingBox({0, 0}, {scaled(disp_w), scaled(disp_h)});
+
+    ExPolygon poly = square_with_hole(30.);
+    poly.rotate(0.3);
+    poly.translate(bb.center().x(), bb.center().y());
+
+    for (auto orientation : {sla::RasterBase::roLandscape, sla::RasterBase::roPortrait})
+        for (auto &mirror : {sla::RasterBase::NoMirror, sla::RasterBase::MirrorXY}) {
+            sla::RasterBase::Trafo trafo{orientation, mirror};
+            sla::RasterGrayscaleAA  aa(res, pixdim, trafo, agg::gamma_threshold(.5));
+            sla::RasterGrayscaleScanline scan(res, pixdim, trafo);
+            aa.draw(poly);
+            scan.draw(poly);
+
+            size_t white = 0, mismatch = 0;
+            for (size_t r = 0; r < res.height_px; ++r)
+                for (size_t c = 0; c < res.width_px; ++c) {
+                    uint8_t px = scan.read_pixel(c, r);
+                    REQUIRE((px == 0 || px == FullWhite));
+                    white += px == FullWhite;
+                    mismatch += px != aa.read_pixel(c, r);
+                }
+
+            REQUIRE(white > 0);
+            // Only the pixels halved by the polygon edges may differ.
+            REQUIRE(mismatch < white / 1000 + 10);
+        }
+}
+
+TEST_CASE("PNG encoded layer image decodes to the raw image", "[SLARasterOutput]") {
+    const size_t w = 300, h = 200;
+    std::vector<uint8_t> img(w * h, 0);
+    for (size_t y = 50; y < 150; ++y)
+        for (size_t x = 20; x < 280; ++x)
+            img[y * w + x] = uint8_t(x < 100 ? 255 : (x * y) & 0xFF);
+
+    sla::EncodedRaster enc = sla::PNGRasterEncoder{}(img.data(), w, h, 1);
+    REQUIRE(std::string(enc.extension()) == "png");
+
+    // Compressed as well as by the miniz PNG writer.
+    size_t miniz_size = 0;
+    void  *miniz_png  = tdefl_write_image_to_png_file_in_memory(img.data(), int(w), int(h), 1, &miniz_size);
+    REQUIRE(miniz_png != nullptr);
+    MZ_FREE(miniz_png);
+    REQUIRE(enc.size() == miniz_size);
+
+    png::ImageGreyscale decoded;
+    REQUIRE(png::decode_png(png::ReadBuf{enc.data(), enc.size()}, decoded));
+    REQUIRE(decoded.cols == w);
+    REQUIRE(decoded.rows == h);
+    REQUIRE(decoded.buf == img);
+}
+
 TEST_CASE("halfcone test", "[halfcone]") {
     sla::DiffBridge br{Vec3d{1., 1., 1.}, Vec3d{10., 10., 10.}, 0.25, 0.5};
 
@@ -261,6 +322,112 @@ TEST_CASE("halfcone test", "[halfcone]") {
     its_write_obj(m, "Halfcone.obj");
 }
 
+TEST_CASE("Support tree sliced without meshing matches the sliced mesh", "[SLASupportGeneration]") {
+    sla::SupportTreeBuilder builder;
+
+    Vec3d headdir = Vec3d{0.2, 0.1, -1.}.normalized();
+    builder.add_head(0, 0.5, 0.2, 1., 0.2, headdir, Vec3d{0., 0., 10.});
+    long pid = builder.add_pillar(long(0), 6.);
+    builder.add_pillar_base(pid, 1., 2.);
+    const sla::Junction &j = builder.add_junction(Vec3d{3., 2., 6.}, 0.5);
+    builder.add_bridge(builder.pillar(pid).endpoint() + Vec3d{0., 0., 3.}, j.pos, 0.4);
+    builder.add_diffbridge(j.pos, Vec3d{5., 2., 9.}, 0.5, 0.3);
+
+    std::vector<float> slicegrid = grid(0.05f, 12.f, 0.1f);
+    std::vector<ExPolygons> analytic = sla::slice(builder, slicegrid, {});
+    std::vector<ExPolygons> meshed   = slice_mesh_ex(builder.merged_mesh(), slicegrid);
+
+    REQUIRE(analytic.size() == meshed.size());
+    for (size_t i = 0; i < analytic.size(); ++i) {
+        double area_analytic = area(analytic[i]) * SCALING_FACTOR * SCALING_FACTOR;
+        double area_meshed   = area(meshed[i]) * SCALING_FACTOR * SCALING_FACTOR;
+        REQUIRE(std::abs(area_analytic - area_meshed) <= 0.1 * area_meshed + 0.02);
+    }
+}
+
+TEST_CASE("Support slices patched from the cache match a full slicing", "[SLASupportGeneration]") {
+    sla::SupportTreeBuilder builder;
+
+    builder.add_head(0, 0.5, 0.2, 1., 0.2, Vec3d{0., 0., -1.}, Vec3d{0., 0., 10.});
+    long pid = builder.add_pillar(long(0), 6.);
+    builder.add_pillar_base(pid, 1., 2.);
+
+    std::vector<float> slicegrid = grid(0.05f, 12.f, 0.1f);
+    sla::SupportSlicesCache cache;
+    sla::slice(builder, slicegrid, {}, cache);
+    REQUIRE(cache.slices.size() == slicegrid.size());
+
+    // A local edit: a junction reaching a few layers only.
+    builder.add_junction(Vec3d{3., 2., 6.}, 0.5);
+
+    std::vector<ExPolygons> patched = sla::slice(builder, slicegrid, {}, cache);
+    std::vector<ExPolygons> full    = sla::slice(builder, slicegrid, {});
+
+    REQUIRE(patched.size() == full.size());
+    for (size_t i = 0; i < full.size(); ++i)
+        REQUIRE(area(patched[i]) == Approx(area(full[i])));
+}
+
+TEST_CASE("Support slices are not reused for a changed primitive", "[SLASupportGeneration]") {
+    std::vector<float> slicegrid = grid(0.05f, 12.f, 0.1f);
+    auto make_tree = [](sla::SupportTreeBuilder &builder, double junction_r) {
+        builder.add_head(0, 0.5, 0.2, 1., 0.2, Vec3d{0., 0., -1.}, Vec3d{0., 0., 10.});
+        long pid = builder.add_pillar(long(0), 6.);
+        builder.add_pillar_base(pid, 1., 2.);
+        builder.add_junction(Vec3d{3., 2., 6.}, junction_r);
+    };
+
+    sla::SupportSlicesCache cache;
+    {
+        sla::SupportTreeBuilder builder;
+        make_tree(builder, 0.5);
+        sla::slice(builder, slicegrid, {}, cache);
+    }
+
+    // The same primitives, only the radius of the junction differs.
+    sla::SupportTreeBuilder builder;
+    make_tree(builder, 0.8);
+    std::vector<ExPolygons> patched = sla::slice(builder, slicegrid, {}, cache);
+    std::vector<ExPolygons> full    = sla::slice(builder, slicegrid, {});
+
+    REQUIRE(patched.size() == full.size());
+    for (size_t i = 0; i < full.size(); ++i)
+        REQUIRE(area(patched[i]) == Approx(area(full[i])));
+}
+
+TEST_CASE("Layer times are reported in layer order with the faded layers", "[SLAPrint]") {
+    SLAPrint print;
+    SLAFullPrintConfig fullcfg;
+    fullcfg.printer_technology.setInt(ptSLA);
+    fullcfg.set("supports_enable", false);
+    fullcfg.set("pad_enable", false);
+    // All layers of equal height, thus the layer times only differ by the exposure.
+    fullcfg.set("layer_height", 0.05);
+    fullcfg.set("initial_layer_height", 0.05);
+    fullcfg.set("initial_exposure_time", 35.);
+    fullcfg.set("exposure_time", 10.);
+    fullcfg.set("faded_layers", 4);
+
+    DynamicPrintConfig cfg;
+    cfg.apply(fullcfg);
+
+    Model m = Model::read_from_file(TEST_DATA_DIR PATH_SEPARATOR + std::string("20mm_cube.obj"), nullptr);
+    print.set_status_callback([](const PrintBase::SlicingStatus&) {});
+    print.apply(m, cfg);
+    print.process();
+
+    const std::vector<double> &layers_times = print.print_statistics().layers_times;
+    REQUIRE(layers_times.size() == print.print_layers().size());
+    REQUIRE(layers_times.size() > 100);
+
+    // Three layers of the initial exposure, then the exposure fades by (35 - 10) / (4 + 1) seconds per layer.
+    auto exposure = [](size_t layer_id) { return layer_id < 3 ? 35. : std::max(10., 35. - 5. * double(layer_id - 2)); };
+    for (size_t i = 0; i < layers_times.size(); ++ i)
+        REQUIRE(layers_times[i] - layers_times.back() == Approx(exposure(i) - 10.).margin(1e-3));
+    REQUIRE(print.print_statistics().estimated_print_time ==
+            Approx(std::accumulate(layers_times.begin(), layers_times.end(), 0.)));
+}
+
 TEST_CASE("Test concurrency")
 {
     std::vector<double> vals = grid(0., 100., 10.);